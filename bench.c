@@ -0,0 +1,367 @@
+/*
+ * micro-benchmarks for the hot paths in pinochle.c
+ *
+ * every benchmark runs a batch of operations per sample, sized so a
+ * sample takes about BENCH_SAMPLE_NS, after a warmup of BENCH_WARMUP_NS.
+ * the result is ns per operation over the samples, as csv or json.
+ *
+ * usage: bench [--json] [--samples N] [filter]
+ */
+
+#define PINOCHLE_NO_MAIN
+#include "pinochle.c"
+
+#include <math.h>
+#include <time.h>
+
+#define BENCH_WARMUP_NS 50000000ULL
+#define BENCH_SAMPLE_NS 2000000ULL
+#define BENCH_MAX_SAMPLES 1000
+#define BENCH_MAX_OPS (1ULL << 40)
+
+/* what a benchmark is given: scratch state set up once, and a sink that
+ * results are folded into so the compiler cannot drop the work. */
+struct bench_ctx
+{
+    struct pinochle* game;
+    guint64 hands[1024];
+    struct memo* memo; /* holds a result for every hand and trump */
+    guint64 sink;
+};
+
+/* runs n operations. */
+typedef void (*bench_fn)(struct bench_ctx* ctx, guint64 n);
+
+struct bench
+{
+    const gchar* name;
+    bench_fn fn;
+};
+
+struct bench_result
+{
+    const gchar* name;
+    guint64 ops_per_sample;
+    guint32 nsamples;
+    double min;
+    double median;
+    double mean;
+    double stddev;
+    double max;
+};
+
+/* makes p look used, so an allocation is not optimized away. */
+void
+bench_escape(void* p)
+{
+    __asm__ volatile("" : : "g"(p) : "memory");
+}
+
+guint64
+bench_now_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (guint64)ts.tv_sec * 1000000000ULL + (guint64)ts.tv_nsec;
+}
+
+void
+bench_deck_new(struct bench_ctx* ctx, guint64 n)
+{
+    for (guint64 i = 0; i < n; i++) {
+        struct deck* d = deck_new();
+        bench_escape(d);
+        ctx->sink += d->cards.bits;
+        deck_free(d);
+    }
+}
+
+void
+bench_deal(struct bench_ctx* ctx, guint64 n)
+{
+    for (guint64 i = 0; i < n; i++) {
+        pinochle_reset(ctx->game, ctx->sink + i);
+        pinochle_deal_init(ctx->game);
+        ctx->sink += ctx->game->hands[0].cards.bits;
+    }
+}
+
+void
+bench_card_list(struct bench_ctx* ctx, guint64 n)
+{
+    struct card_list* cl = card_list_new();
+    struct card c = { spades, queen, in_deck };
+    for (guint64 i = 0; i < n; i++) {
+        c.suit = (guint8)(i & 3);
+        card_list_add(cl, &c);
+        card_list_remove(cl, 0, &c);
+        ctx->sink += c.rank;
+    }
+    card_list_free(cl);
+}
+
+void
+bench_card_str(struct bench_ctx* ctx, guint64 n)
+{
+    for (guint64 i = 0; i < n; i++) {
+        struct card c = { (guint8)(i & 3), (guint8)(i % NRANK), in_deck };
+        ctx->sink += (guint64)card_str(&c)[0];
+    }
+}
+
+void
+bench_hand_format(struct bench_ctx* ctx, guint64 n)
+{
+    gchar buf[CARD_SET_STR_MAX];
+    for (guint64 i = 0; i < n; i++) {
+        struct card_set s = { ctx->hands[i & 1023] };
+        ctx->sink += card_set_format(s, buf);
+    }
+}
+
+void
+bench_meld_eval(struct bench_ctx* ctx, guint64 n)
+{
+    for (guint64 i = 0; i < n; i++) {
+        struct card_set s = { ctx->hands[i & 1023] };
+        ctx->sink += meld_total(s, (enum suit)(i & 3));
+    }
+}
+
+void
+bench_meld_best_trump(struct bench_ctx* ctx, guint64 n)
+{
+    for (guint64 i = 0; i < n; i++) {
+        struct card_set s = { ctx->hands[i & 1023] };
+        guint32 total;
+        ctx->sink += meld_best_trump(s, &total) + total;
+    }
+}
+
+/* one trick of two cards, each checked for legality first. */
+void
+bench_trick(struct bench_ctx* ctx, guint64 n)
+{
+    struct trick t;
+    for (guint64 i = 0; i < n; i++) {
+        struct card_set lead = { ctx->hands[i & 1023] };
+        struct card_set follow = { ctx->hands[(i + 1) & 1023] };
+        enum suit trump = (enum suit)(i & 3);
+        trick_clear(&t);
+        struct card_set legal = trick_legal(&t, lead, trump);
+        trick_play(&t, (guint8)bit_first(card_set_presence(legal)), trump);
+        legal = trick_legal(&t, follow, trump);
+        trick_play(&t, (guint8)bit_first(card_set_presence(legal)), trump);
+        ctx->sink += t.winner + t.counters;
+    }
+}
+
+/* one hand of a batch of 1024 per op. */
+void
+bench_batch_eval(struct bench_ctx* ctx, guint64 n)
+{
+    static guint8 out[6][1024];
+    static guint16 meld[1024];
+    struct hand_batch b;
+    b.hands = ctx->hands;
+    b.counters = out[0];
+    for (guint32 suit = 0; suit < NSUIT; suit++) {
+        b.suit_len[suit] = out[1 + suit];
+    }
+    b.best_trump = out[5];
+    b.meld = meld;
+    for (guint64 done = 0; done < n; done += b.nhands) {
+        b.nhands = (guint32)(n - done < 1024 ? n - done : 1024);
+        batch_eval(&b);
+        ctx->sink += meld[0];
+    }
+}
+
+/* a memo hit, the most a memoized result can cost. */
+void
+bench_memo_get(struct bench_ctx* ctx, guint64 n)
+{
+    for (guint64 i = 0; i < n; i++) {
+        struct card_set s = { ctx->hands[i & 1023] };
+        guint64 value = 0;
+        memo_get(ctx->memo, memo_key_hand(s, (enum suit)(i & 3)), &value);
+        ctx->sink += value;
+    }
+}
+
+const struct bench BENCHES[] = {
+    { "deck_new", bench_deck_new },
+    { "deal", bench_deal },
+    { "card_list_add_remove", bench_card_list },
+    { "card_str", bench_card_str },
+    { "card_set_format", bench_hand_format },
+    { "meld_eval", bench_meld_eval },
+    { "meld_best_trump", bench_meld_best_trump },
+    { "trick", bench_trick },
+    { "batch_eval", bench_batch_eval },
+    { "memo_get", bench_memo_get },
+};
+
+int
+bench_compare_double(const void* a, const void* b)
+{
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+
+    return (x > y) - (x < y);
+}
+
+/* warms up, sizes a sample to about BENCH_SAMPLE_NS, then takes nsamples
+ * samples of ns per operation. */
+void
+bench_run(const struct bench* b,
+          struct bench_ctx* ctx,
+          guint32 nsamples,
+          struct bench_result* out)
+{
+    guint64 n = 1;
+    guint64 start = bench_now_ns();
+    while (bench_now_ns() - start < BENCH_WARMUP_NS) {
+        guint64 t0 = bench_now_ns();
+        b->fn(ctx, n);
+        guint64 elapsed = bench_now_ns() - t0;
+        if (elapsed < BENCH_SAMPLE_NS / 2 && n < BENCH_MAX_OPS) {
+            n *= 2;
+        } else if (elapsed > BENCH_SAMPLE_NS * 2 && n > 1) {
+            n /= 2;
+        }
+    }
+
+    static double ns[BENCH_MAX_SAMPLES];
+    for (guint32 i = 0; i < nsamples; i++) {
+        guint64 t0 = bench_now_ns();
+        b->fn(ctx, n);
+        ns[i] = (double)(bench_now_ns() - t0) / (double)n;
+    }
+    qsort(ns, nsamples, sizeof(double), bench_compare_double);
+
+    double sum = 0.0;
+    for (guint32 i = 0; i < nsamples; i++) {
+        sum += ns[i];
+    }
+    double mean = sum / nsamples;
+    double var = 0.0;
+    for (guint32 i = 0; i < nsamples; i++) {
+        var += (ns[i] - mean) * (ns[i] - mean);
+    }
+
+    out->name = b->name;
+    out->ops_per_sample = n;
+    out->nsamples = nsamples;
+    out->min = ns[0];
+    out->median = nsamples % 2 == 1
+                    ? ns[nsamples / 2]
+                    : (ns[nsamples / 2 - 1] + ns[nsamples / 2]) / 2.0;
+    out->mean = mean;
+    out->stddev = nsamples > 1 ? sqrt(var / (nsamples - 1)) : 0.0;
+    out->max = ns[nsamples - 1];
+}
+
+void
+bench_show_csv(struct bench_result* r, guint32 nresults)
+{
+    printf("name,ops_per_sample,samples,min_ns,median_ns,mean_ns,stddev_ns,"
+           "max_ns\n");
+    for (guint32 i = 0; i < nresults; i++) {
+        printf("%s,%" G_GUINT64_FORMAT ",%u,%.2f,%.2f,%.2f,%.2f,%.2f\n",
+               r[i].name,
+               r[i].ops_per_sample,
+               r[i].nsamples,
+               r[i].min,
+               r[i].median,
+               r[i].mean,
+               r[i].stddev,
+               r[i].max);
+    }
+}
+
+void
+bench_show_json(struct bench_result* r, guint32 nresults)
+{
+    printf("[\n");
+    for (guint32 i = 0; i < nresults; i++) {
+        printf("  { \"name\": \"%s\", \"ops_per_sample\": %" G_GUINT64_FORMAT
+               ", \"samples\": %u, \"min_ns\": %.2f, \"median_ns\": %.2f, "
+               "\"mean_ns\": %.2f, \"stddev_ns\": %.2f, \"max_ns\": %.2f }%s\n",
+               r[i].name,
+               r[i].ops_per_sample,
+               r[i].nsamples,
+               r[i].min,
+               r[i].median,
+               r[i].mean,
+               r[i].stddev,
+               r[i].max,
+               i + 1 < nresults ? "," : "");
+    }
+    printf("]\n");
+}
+
+int
+main(int argc, char** argv)
+{
+    guint32 json = 0;
+    guint32 nsamples = 30;
+    const gchar* filter = NULL;
+    for (int i = 1; i < argc; i++) {
+        if (g_strcmp0(argv[i], "--json") == 0) {
+            json = 1;
+        } else if (g_strcmp0(argv[i], "--samples") == 0 && i + 1 < argc) {
+            nsamples = (guint32)g_ascii_strtoull(argv[++i], NULL, 10);
+        } else {
+            filter = argv[i];
+        }
+    }
+    if (nsamples == 0 || nsamples > BENCH_MAX_SAMPLES) {
+        printf("ERROR: samples must be between 1 and %u.\n", BENCH_MAX_SAMPLES);
+
+        return 1;
+    }
+
+    struct bench_ctx ctx;
+    const gchar* names[] = { "north", "east", "south", "west" };
+    ctx.game = pinochle_new(NPLAYERS, NDECKS, names, 1);
+    ctx.sink = 0;
+    /* dealt hands to evaluate */
+    for (guint32 i = 0; i < 1024; i += NPLAYERS) {
+        pinochle_reset(ctx.game, i);
+        pinochle_deal_init(ctx.game);
+        for (guint32 seat = 0; seat < NPLAYERS; seat++) {
+            ctx.hands[i + seat] = ctx.game->hands[seat].cards.bits;
+        }
+    }
+    ctx.memo = memo_new(1 << 20, 8, memo_lru);
+    for (guint32 i = 0; i < 1024; i++) {
+        struct card_set s = { ctx.hands[i] };
+        for (guint32 suit = 0; suit < NSUIT; suit++) {
+            memo_put(ctx.memo,
+                     memo_key_hand(s, (enum suit)suit),
+                     meld_total(s, (enum suit)suit));
+        }
+    }
+
+    guint32 nbenches = sizeof(BENCHES) / sizeof(BENCHES[0]);
+    struct bench_result results[sizeof(BENCHES) / sizeof(BENCHES[0])];
+    guint32 nresults = 0;
+    for (guint32 i = 0; i < nbenches; i++) {
+        if (filter != NULL && strstr(BENCHES[i].name, filter) == NULL) {
+            continue;
+        }
+        bench_run(&BENCHES[i], &ctx, nsamples, &results[nresults++]);
+    }
+    if (json) {
+        bench_show_json(results, nresults);
+    } else {
+        bench_show_csv(results, nresults);
+    }
+    memo_free(ctx.memo);
+    pinochle_free(ctx.game);
+    bench_escape(&ctx.sink);
+
+    return 0;
+}
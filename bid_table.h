@@ -0,0 +1,519 @@
+/* generated by `console bid-table` from 1000000 play-outs; do not edit. */
+
+const guint8 BID_TRUMP_LANE[MELD_LANE_PATTERNS] = {
+  0, 15, 30, 45, 10, 27, 42, 57, 23, 40, 56, 74, 36, 51, 71, 91,
+  7, 25, 42, 54, 19, 39, 56, 71, 35, 53, 69, 88, 45, 65, 85, 105,
+  17, 36, 55, 68, 32, 52, 69, 85, 48, 66, 81, 102, 59, 79, 99, 119,
+  27, 42, 62, 82, 39, 59, 79, 99, 56, 76, 96, 116, 73, 93, 113, 133,
+  1, 16, 33, 51, 12, 31, 48, 68, 27, 45, 62, 85, 42, 62, 82, 102,
+  9, 28, 47, 65, 22, 44, 61, 82, 39, 58, 75, 99, 56, 76, 96, 116,
+  20, 40, 60, 79, 36, 57, 75, 96, 53, 71, 90, 113, 70, 90, 110, 130,
+  33, 53, 73, 93, 50, 70, 90, 110, 67, 87, 107, 127, 84, 104, 124, 144,
+  3, 20, 38, 62, 15, 35, 54, 79, 31, 50, 66, 96, 53, 73, 93, 113,
+  13, 32, 52, 76, 27, 49, 67, 93, 44, 64, 81, 110, 67, 87, 107, 127,
+  24, 45, 65, 90, 41, 62, 81, 107, 56, 74, 98, 124, 81, 101, 121, 141,
+  44, 64, 84, 104, 61, 81, 101, 121, 78, 98, 118, 138, 95, 115, 135, 155,
+  18, 33, 53, 73, 30, 50, 70, 90, 47, 67, 87, 107, 64, 84, 104, 124,
+  27, 47, 67, 87, 44, 64, 84, 104, 61, 81, 101, 121, 78, 98, 118, 138,
+  41, 61, 81, 101, 58, 78, 98, 118, 75, 95, 115, 135, 92, 112, 132, 152,
+  55, 75, 95, 115, 72, 92, 112, 132, 89, 109, 129, 149, 106, 126, 146, 166,
+  1, 16, 33, 51, 12, 31, 48, 68, 26, 45, 61, 85, 42, 62, 82, 102,
+  9, 28, 47, 65, 22, 44, 61, 82, 39, 58, 75, 99, 56, 76, 96, 116,
+  20, 40, 60, 79, 36, 57, 74, 96, 52, 71, 89, 113, 70, 90, 110, 130,
+  33, 53, 73, 93, 50, 70, 90, 110, 67, 87, 107, 127, 84, 104, 124, 144,
+  3, 19, 38, 62, 15, 35, 53, 79, 31, 50, 67, 96, 53, 73, 93, 113,
+  12, 32, 52, 76, 27, 49, 67, 93, 44, 63, 81, 110, 67, 87, 107, 127,
+  24, 45, 66, 90, 41, 62, 81, 107, 56, 77, 95, 124, 81, 101, 121, 141,
+  44, 64, 84, 104, 61, 81, 101, 121, 78, 98, 118, 138, 95, 115, 135, 155,
+  6, 24, 44, 73, 19, 41, 60, 90, 36, 57, 74, 107, 64, 84, 104, 124,
+  17, 37, 57, 87, 32, 54, 73, 104, 49, 70, 93, 121, 78, 98, 118, 138,
+  29, 51, 73, 101, 47, 68, 91, 118, 63, 86, 111, 135, 92, 112, 132, 152,
+  55, 75, 95, 115, 72, 92, 112, 132, 89, 109, 129, 149, 106, 126, 146, 166,
+  24, 44, 64, 84, 41, 61, 81, 101, 58, 78, 98, 118, 75, 95, 115, 135,
+  38, 58, 78, 98, 55, 75, 95, 115, 72, 92, 112, 132, 89, 109, 129, 149,
+  52, 72, 92, 112, 69, 89, 109, 129, 86, 106, 126, 146, 103, 123, 143, 163,
+  66, 86, 106, 126, 83, 103, 123, 143, 100, 120, 140, 160, 117, 137, 157, 177,
+  3, 19, 38, 62, 15, 35, 53, 79, 31, 51, 68, 96, 53, 73, 93, 113,
+  12, 32, 52, 76, 27, 49, 67, 93, 44, 64, 79, 110, 67, 87, 107, 127,
+  24, 45, 65, 90, 40, 62, 81, 107, 56, 78, 98, 124, 81, 101, 121, 141,
+  44, 64, 84, 104, 61, 81, 101, 121, 78, 98, 118, 138, 95, 115, 135, 155,
+  6, 23, 43, 73, 19, 40, 59, 90, 36, 56, 74, 107, 64, 84, 104, 124,
+  17, 37, 58, 87, 32, 55, 73, 104, 49, 70, 90, 121, 78, 98, 118, 138,
+  29, 50, 74, 101, 46, 68, 88, 118, 65, 87, 115, 135, 92, 112, 132, 152,
+  55, 75, 95, 115, 72, 92, 112, 132, 89, 109, 129, 149, 106, 126, 146, 166,
+  10, 29, 50, 84, 24, 45, 68, 101, 41, 65, 93, 118, 75, 95, 115, 135,
+  22, 41, 64, 98, 37, 61, 84, 115, 58, 82, 111, 132, 89, 109, 129, 149,
+  35, 54, 83, 112, 54, 80, 106, 129, 76, 106, 126, 146, 103, 123, 143, 163,
+  66, 86, 106, 126, 83, 103, 123, 143, 100, 120, 140, 160, 117, 137, 157, 177,
+  35, 55, 75, 95, 52, 72, 92, 112, 69, 89, 109, 129, 86, 106, 126, 146,
+  49, 69, 89, 109, 66, 86, 106, 126, 83, 103, 123, 143, 100, 120, 140, 160,
+  63, 83, 103, 123, 80, 100, 120, 140, 97, 117, 137, 157, 114, 134, 154, 174,
+  77, 97, 117, 137, 94, 114, 134, 154, 111, 131, 151, 171, 128, 148, 168, 188,
+  18, 33, 53, 73, 30, 50, 70, 90, 47, 67, 87, 107, 64, 84, 104, 124,
+  27, 47, 67, 87, 44, 64, 84, 104, 61, 81, 101, 121, 78, 98, 118, 138,
+  41, 61, 81, 101, 58, 78, 98, 118, 75, 95, 115, 135, 92, 112, 132, 152,
+  55, 75, 95, 115, 72, 92, 112, 132, 89, 109, 129, 149, 106, 126, 146, 166,
+  24, 44, 64, 84, 41, 61, 81, 101, 58, 78, 98, 118, 75, 95, 115, 135,
+  38, 58, 78, 98, 55, 75, 95, 115, 72, 92, 112, 132, 89, 109, 129, 149,
+  52, 72, 92, 112, 69, 89, 109, 129, 86, 106, 126, 146, 103, 123, 143, 163,
+  66, 86, 106, 126, 83, 103, 123, 143, 100, 120, 140, 160, 117, 137, 157, 177,
+  35, 55, 75, 95, 52, 72, 92, 112, 69, 89, 109, 129, 86, 106, 126, 146,
+  49, 69, 89, 109, 66, 86, 106, 126, 83, 103, 123, 143, 100, 120, 140, 160,
+  63, 83, 103, 123, 80, 100, 120, 140, 97, 117, 137, 157, 114, 134, 154, 174,
+  77, 97, 117, 137, 94, 114, 134, 154, 111, 131, 151, 171, 128, 148, 168, 188,
+  46, 66, 86, 106, 63, 83, 103, 123, 80, 100, 120, 140, 97, 117, 137, 157,
+  60, 80, 100, 120, 77, 97, 117, 137, 94, 114, 134, 154, 111, 131, 151, 171,
+  74, 94, 114, 134, 91, 111, 131, 151, 108, 128, 148, 168, 125, 145, 165, 185,
+  88, 108, 128, 148, 105, 125, 145, 165, 122, 142, 162, 182, 139, 159, 179, 199,
+  1, 16, 33, 51, 12, 30, 47, 68, 26, 45, 61, 85, 42, 62, 82, 102,
+  9, 27, 46, 65, 22, 43, 61, 82, 38, 58, 75, 99, 56, 76, 96, 116,
+  19, 40, 59, 79, 35, 57, 74, 96, 51, 71, 89, 113, 70, 90, 110, 130,
+  33, 53, 73, 93, 50, 70, 90, 110, 67, 87, 107, 127, 84, 104, 124, 144,
+  3, 19, 38, 62, 14, 35, 53, 79, 30, 50, 67, 96, 53, 73, 93, 113,
+  12, 31, 52, 76, 26, 49, 67, 93, 44, 63, 81, 110, 67, 87, 107, 127,
+  23, 44, 64, 90, 40, 62, 81, 107, 57, 77, 99, 124, 81, 101, 121, 141,
+  44, 64, 84, 104, 61, 81, 101, 121, 78, 98, 118, 138, 95, 115, 135, 155,
+  5, 23, 43, 73, 19, 40, 59, 90, 35, 56, 74, 107, 64, 84, 104, 124,
+  17, 37, 58, 87, 31, 54, 73, 104, 49, 71, 90, 121, 78, 98, 118, 138,
+  29, 50, 74, 101, 46, 68, 90, 118, 61, 88, 111, 135, 92, 112, 132, 152,
+  55, 75, 95, 115, 72, 92, 112, 132, 89, 109, 129, 149, 106, 126, 146, 166,
+  24, 44, 64, 84, 41, 61, 81, 101, 58, 78, 98, 118, 75, 95, 115, 135,
+  38, 58, 78, 98, 55, 75, 95, 115, 72, 92, 112, 132, 89, 109, 129, 149,
+  52, 72, 92, 112, 69, 89, 109, 129, 86, 106, 126, 146, 103, 123, 143, 163,
+  66, 86, 106, 126, 83, 103, 123, 143, 100, 120, 140, 160, 117, 137, 157, 177,
+  3, 19, 37, 62, 14, 35, 53, 79, 30, 50, 67, 96, 53, 73, 93, 113,
+  11, 31, 52, 76, 26, 48, 66, 93, 43, 64, 81, 110, 67, 87, 107, 127,
+  23, 44, 65, 90, 40, 62, 80, 107, 57, 77, 95, 124, 81, 101, 121, 141,
+  44, 64, 84, 104, 61, 81, 101, 121, 78, 98, 118, 138, 95, 115, 135, 155,
+  5, 23, 43, 73, 18, 40, 59, 90, 35, 56, 74, 107, 64, 84, 104, 124,
+  16, 36, 57, 87, 31, 54, 73, 104, 49, 69, 87, 121, 78, 98, 118, 138,
+  29, 50, 72, 101, 46, 68, 88, 118, 62, 85, 108, 135, 92, 112, 132, 152,
+  55, 75, 95, 115, 72, 92, 112, 132, 89, 109, 129, 149, 106, 126, 146, 166,
+  10, 28, 49, 84, 24, 45, 65, 101, 40, 63, 82, 118, 75, 95, 115, 135,
+  22, 42, 63, 98, 37, 61, 80, 115, 55, 77, 100, 132, 89, 109, 129, 149,
+  35, 57, 79, 112, 53, 76, 103, 129, 72, 100, 126, 146, 103, 123, 143, 163,
+  66, 86, 106, 126, 83, 103, 123, 143, 100, 120, 140, 160, 117, 137, 157, 177,
+  35, 55, 75, 95, 52, 72, 92, 112, 69, 89, 109, 129, 86, 106, 126, 146,
+  49, 69, 89, 109, 66, 86, 106, 126, 83, 103, 123, 143, 100, 120, 140, 160,
+  63, 83, 103, 123, 80, 100, 120, 140, 97, 117, 137, 157, 114, 134, 154, 174,
+  77, 97, 117, 137, 94, 114, 134, 154, 111, 131, 151, 171, 128, 148, 168, 188,
+  5, 23, 42, 73, 18, 40, 59, 90, 34, 56, 76, 107, 64, 84, 104, 124,
+  16, 36, 58, 87, 30, 54, 74, 104, 49, 70, 90, 121, 78, 98, 118, 138,
+  29, 50, 71, 101, 46, 67, 90, 118, 64, 85, 109, 135, 92, 112, 132, 152,
+  55, 75, 95, 115, 72, 92, 112, 132, 89, 109, 129, 149, 106, 126, 146, 166,
+  9, 28, 48, 84, 23, 46, 66, 101, 40, 63, 85, 118, 75, 95, 115, 135,
+  21, 42, 64, 98, 37, 60, 83, 115, 55, 78, 105, 132, 89, 109, 129, 149,
+  35, 55, 82, 112, 52, 76, 107, 129, 75, 98, 126, 146, 103, 123, 143, 163,
+  66, 86, 106, 126, 83, 103, 123, 143, 100, 120, 140, 160, 117, 137, 157, 177,
+  15, 34, 56, 95, 30, 52, 75, 112, 51, 70, 108, 129, 86, 106, 126, 146,
+  28, 47, 73, 109, 43, 67, 100, 126, 65, 98, 123, 143, 100, 120, 140, 160,
+  42, 66, 102, 123, 64, 87, 120, 140, 96, 116, 137, 157, 114, 134, 154, 174,
+  77, 97, 117, 137, 94, 114, 134, 154, 111, 131, 151, 171, 128, 148, 168, 188,
+  46, 66, 86, 106, 63, 83, 103, 123, 80, 100, 120, 140, 97, 117, 137, 157,
+  60, 80, 100, 120, 77, 97, 117, 137, 94, 114, 134, 154, 111, 131, 151, 171,
+  74, 94, 114, 134, 91, 111, 131, 151, 108, 128, 148, 168, 125, 145, 165, 185,
+  88, 108, 128, 148, 105, 125, 145, 165, 122, 142, 162, 182, 139, 159, 179, 199,
+  24, 44, 64, 84, 41, 61, 81, 101, 58, 78, 98, 118, 75, 95, 115, 135,
+  38, 58, 78, 98, 55, 75, 95, 115, 72, 92, 112, 132, 89, 109, 129, 149,
+  52, 72, 92, 112, 69, 89, 109, 129, 86, 106, 126, 146, 103, 123, 143, 163,
+  66, 86, 106, 126, 83, 103, 123, 143, 100, 120, 140, 160, 117, 137, 157, 177,
+  35, 55, 75, 95, 52, 72, 92, 112, 69, 89, 109, 129, 86, 106, 126, 146,
+  49, 69, 89, 109, 66, 86, 106, 126, 83, 103, 123, 143, 100, 120, 140, 160,
+  63, 83, 103, 123, 80, 100, 120, 140, 97, 117, 137, 157, 114, 134, 154, 174,
+  77, 97, 117, 137, 94, 114, 134, 154, 111, 131, 151, 171, 128, 148, 168, 188,
+  46, 66, 86, 106, 63, 83, 103, 123, 80, 100, 120, 140, 97, 117, 137, 157,
+  60, 80, 100, 120, 77, 97, 117, 137, 94, 114, 134, 154, 111, 131, 151, 171,
+  74, 94, 114, 134, 91, 111, 131, 151, 108, 128, 148, 168, 125, 145, 165, 185,
+  88, 108, 128, 148, 105, 125, 145, 165, 122, 142, 162, 182, 139, 159, 179, 199,
+  57, 77, 97, 117, 74, 94, 114, 134, 91, 111, 131, 151, 108, 128, 148, 168,
+  71, 91, 111, 131, 88, 108, 128, 148, 105, 125, 145, 165, 122, 142, 162, 182,
+  85, 105, 125, 145, 102, 122, 142, 162, 119, 139, 159, 179, 136, 156, 176, 196,
+  99, 119, 139, 159, 116, 136, 156, 176, 133, 153, 173, 193, 150, 170, 190, 210,
+  3, 18, 37, 62, 14, 34, 53, 79, 30, 50, 68, 96, 53, 73, 93, 113,
+  11, 31, 51, 76, 25, 48, 67, 93, 43, 64, 80, 110, 67, 87, 107, 127,
+  23, 44, 66, 90, 40, 61, 80, 107, 57, 77, 101, 124, 81, 101, 121, 141,
+  44, 64, 84, 104, 61, 81, 101, 121, 78, 98, 118, 138, 95, 115, 135, 155,
+  5, 22, 43, 73, 18, 40, 59, 90, 36, 56, 75, 107, 64, 84, 104, 124,
+  16, 36, 57, 87, 31, 54, 73, 104, 48, 70, 92, 121, 78, 98, 118, 138,
+  28, 50, 72, 101, 46, 68, 90, 118, 64, 84, 114, 135, 92, 112, 132, 152,
+  55, 75, 95, 115, 72, 92, 112, 132, 89, 109, 129, 149, 106, 126, 146, 166,
+  9, 28, 47, 84, 24, 46, 66, 101, 41, 62, 90, 118, 75, 95, 115, 135,
+  21, 42, 64, 98, 37, 61, 85, 115, 57, 79, 104, 132, 89, 109, 129, 149,
+  37, 56, 84, 112, 53, 75, 109, 129, 81, 99, 126, 146, 103, 123, 143, 163,
+  66, 86, 106, 126, 83, 103, 123, 143, 100, 120, 140, 160, 117, 137, 157, 177,
+  35, 55, 75, 95, 52, 72, 92, 112, 69, 89, 109, 129, 86, 106, 126, 146,
+  49, 69, 89, 109, 66, 86, 106, 126, 83, 103, 123, 143, 100, 120, 140, 160,
+  63, 83, 103, 123, 80, 100, 120, 140, 97, 117, 137, 157, 114, 134, 154, 174,
+  77, 97, 117, 137, 94, 114, 134, 154, 111, 131, 151, 171, 128, 148, 168, 188,
+  5, 22, 42, 73, 18, 39, 59, 90, 35, 55, 74, 107, 64, 84, 104, 124,
+  15, 36, 57, 87, 31, 54, 74, 104, 49, 70, 91, 121, 78, 98, 118, 138,
+  28, 50, 69, 101, 46, 68, 88, 118, 63, 88, 115, 135, 92, 112, 132, 152,
+  55, 75, 95, 115, 72, 92, 112, 132, 89, 109, 129, 149, 106, 126, 146, 166,
+  9, 28, 48, 84, 23, 45, 66, 101, 40, 63, 84, 118, 75, 95, 115, 135,
+  21, 41, 64, 98, 36, 61, 82, 115, 54, 77, 104, 132, 89, 109, 129, 149,
+  34, 55, 81, 112, 51, 77, 101, 129, 70, 99, 126, 146, 103, 123, 143, 163,
+  66, 86, 106, 126, 83, 103, 123, 143, 100, 120, 140, 160, 117, 137, 157, 177,
+  14, 33, 57, 95, 29, 52, 78, 112, 50, 74, 105, 129, 86, 106, 126, 146,
+  28, 47, 71, 109, 45, 69, 98, 126, 70, 94, 123, 143, 100, 120, 140, 160,
+  40, 70, 97, 123, 61, 86, 114, 140, 94, 117, 137, 157, 114, 134, 154, 174,
+  77, 97, 117, 137, 94, 114, 134, 154, 111, 131, 151, 171, 128, 148, 168, 188,
+  46, 66, 86, 106, 63, 83, 103, 123, 80, 100, 120, 140, 97, 117, 137, 157,
+  60, 80, 100, 120, 77, 97, 117, 137, 94, 114, 134, 154, 111, 131, 151, 171,
+  74, 94, 114, 134, 91, 111, 131, 151, 108, 128, 148, 168, 125, 145, 165, 185,
+  88, 108, 128, 148, 105, 125, 145, 165, 122, 142, 162, 182, 139, 159, 179, 199,
+  9, 27, 49, 84, 23, 45, 66, 101, 42, 63, 94, 118, 75, 95, 115, 135,
+  20, 41, 63, 98, 37, 59, 84, 115, 57, 79, 110, 132, 89, 109, 129, 149,
+  34, 59, 84, 112, 54, 81, 106, 129, 73, 106, 126, 146, 103, 123, 143, 163,
+  66, 86, 106, 126, 83, 103, 123, 143, 100, 120, 140, 160, 117, 137, 157, 177,
+  14, 33, 57, 95, 29, 52, 78, 112, 48, 73, 101, 129, 86, 106, 126, 146,
+  27, 49, 78, 109, 44, 73, 93, 126, 67, 92, 123, 143, 100, 120, 140, 160,
+  43, 68, 97, 123, 61, 100, 117, 140, 93, 117, 137, 157, 114, 134, 154, 174,
+  77, 97, 117, 137, 94, 114, 134, 154, 111, 131, 151, 171, 128, 148, 168, 188,
+  20, 42, 75, 106, 38, 58, 96, 123, 65, 94, 120, 140, 97, 117, 137, 157,
+  35, 58, 97, 120, 59, 91, 117, 137, 85, 114, 134, 154, 111, 131, 151, 171,
+  67, 94, 114, 134, 85, 111, 131, 151, 108, 128, 148, 168, 125, 145, 165, 185,
+  88, 108, 128, 148, 105, 125, 145, 165, 122, 142, 162, 182, 139, 159, 179, 199,
+  57, 77, 97, 117, 74, 94, 114, 134, 91, 111, 131, 151, 108, 128, 148, 168,
+  71, 91, 111, 131, 88, 108, 128, 148, 105, 125, 145, 165, 122, 142, 162, 182,
+  85, 105, 125, 145, 102, 122, 142, 162, 119, 139, 159, 179, 136, 156, 176, 196,
+  99, 119, 139, 159, 116, 136, 156, 176, 133, 153, 173, 193, 150, 170, 190, 210,
+  35, 55, 75, 95, 52, 72, 92, 112, 69, 89, 109, 129, 86, 106, 126, 146,
+  49, 69, 89, 109, 66, 86, 106, 126, 83, 103, 123, 143, 100, 120, 140, 160,
+  63, 83, 103, 123, 80, 100, 120, 140, 97, 117, 137, 157, 114, 134, 154, 174,
+  77, 97, 117, 137, 94, 114, 134, 154, 111, 131, 151, 171, 128, 148, 168, 188,
+  46, 66, 86, 106, 63, 83, 103, 123, 80, 100, 120, 140, 97, 117, 137, 157,
+  60, 80, 100, 120, 77, 97, 117, 137, 94, 114, 134, 154, 111, 131, 151, 171,
+  74, 94, 114, 134, 91, 111, 131, 151, 108, 128, 148, 168, 125, 145, 165, 185,
+  88, 108, 128, 148, 105, 125, 145, 165, 122, 142, 162, 182, 139, 159, 179, 199,
+  57, 77, 97, 117, 74, 94, 114, 134, 91, 111, 131, 151, 108, 128, 148, 168,
+  71, 91, 111, 131, 88, 108, 128, 148, 105, 125, 145, 165, 122, 142, 162, 182,
+  85, 105, 125, 145, 102, 122, 142, 162, 119, 139, 159, 179, 136, 156, 176, 196,
+  99, 119, 139, 159, 116, 136, 156, 176, 133, 153, 173, 193, 150, 170, 190, 210,
+  68, 88, 108, 128, 85, 105, 125, 145, 102, 122, 142, 162, 119, 139, 159, 179,
+  82, 102, 122, 142, 99, 119, 139, 159, 116, 136, 156, 176, 133, 153, 173, 193,
+  96, 116, 136, 156, 113, 133, 153, 173, 130, 150, 170, 190, 147, 167, 187, 207,
+  110, 130, 150, 170, 127, 147, 167, 187, 144, 164, 184, 204, 161, 181, 201, 221,
+  18, 33, 53, 73, 30, 50, 70, 90, 47, 67, 87, 107, 64, 84, 104, 124,
+  27, 47, 67, 87, 44, 64, 84, 104, 61, 81, 101, 121, 78, 98, 118, 138,
+  41, 61, 81, 101, 58, 78, 98, 118, 75, 95, 115, 135, 92, 112, 132, 152,
+  55, 75, 95, 115, 72, 92, 112, 132, 89, 109, 129, 149, 106, 126, 146, 166,
+  24, 44, 64, 84, 41, 61, 81, 101, 58, 78, 98, 118, 75, 95, 115, 135,
+  38, 58, 78, 98, 55, 75, 95, 115, 72, 92, 112, 132, 89, 109, 129, 149,
+  52, 72, 92, 112, 69, 89, 109, 129, 86, 106, 126, 146, 103, 123, 143, 163,
+  66, 86, 106, 126, 83, 103, 123, 143, 100, 120, 140, 160, 117, 137, 157, 177,
+  35, 55, 75, 95, 52, 72, 92, 112, 69, 89, 109, 129, 86, 106, 126, 146,
+  49, 69, 89, 109, 66, 86, 106, 126, 83, 103, 123, 143, 100, 120, 140, 160,
+  63, 83, 103, 123, 80, 100, 120, 140, 97, 117, 137, 157, 114, 134, 154, 174,
+  77, 97, 117, 137, 94, 114, 134, 154, 111, 131, 151, 171, 128, 148, 168, 188,
+  46, 66, 86, 106, 63, 83, 103, 123, 80, 100, 120, 140, 97, 117, 137, 157,
+  60, 80, 100, 120, 77, 97, 117, 137, 94, 114, 134, 154, 111, 131, 151, 171,
+  74, 94, 114, 134, 91, 111, 131, 151, 108, 128, 148, 168, 125, 145, 165, 185,
+  88, 108, 128, 148, 105, 125, 145, 165, 122, 142, 162, 182, 139, 159, 179, 199,
+  24, 44, 64, 84, 41, 61, 81, 101, 58, 78, 98, 118, 75, 95, 115, 135,
+  38, 58, 78, 98, 55, 75, 95, 115, 72, 92, 112, 132, 89, 109, 129, 149,
+  52, 72, 92, 112, 69, 89, 109, 129, 86, 106, 126, 146, 103, 123, 143, 163,
+  66, 86, 106, 126, 83, 103, 123, 143, 100, 120, 140, 160, 117, 137, 157, 177,
+  35, 55, 75, 95, 52, 72, 92, 112, 69, 89, 109, 129, 86, 106, 126, 146,
+  49, 69, 89, 109, 66, 86, 106, 126, 83, 103, 123, 143, 100, 120, 140, 160,
+  63, 83, 103, 123, 80, 100, 120, 140, 97, 117, 137, 157, 114, 134, 154, 174,
+  77, 97, 117, 137, 94, 114, 134, 154, 111, 131, 151, 171, 128, 148, 168, 188,
+  46, 66, 86, 106, 63, 83, 103, 123, 80, 100, 120, 140, 97, 117, 137, 157,
+  60, 80, 100, 120, 77, 97, 117, 137, 94, 114, 134, 154, 111, 131, 151, 171,
+  74, 94, 114, 134, 91, 111, 131, 151, 108, 128, 148, 168, 125, 145, 165, 185,
+  88, 108, 128, 148, 105, 125, 145, 165, 122, 142, 162, 182, 139, 159, 179, 199,
+  57, 77, 97, 117, 74, 94, 114, 134, 91, 111, 131, 151, 108, 128, 148, 168,
+  71, 91, 111, 131, 88, 108, 128, 148, 105, 125, 145, 165, 122, 142, 162, 182,
+  85, 105, 125, 145, 102, 122, 142, 162, 119, 139, 159, 179, 136, 156, 176, 196,
+  99, 119, 139, 159, 116, 136, 156, 176, 133, 153, 173, 193, 150, 170, 190, 210,
+  35, 55, 75, 95, 52, 72, 92, 112, 69, 89, 109, 129, 86, 106, 126, 146,
+  49, 69, 89, 109, 66, 86, 106, 126, 83, 103, 123, 143, 100, 120, 140, 160,
+  63, 83, 103, 123, 80, 100, 120, 140, 97, 117, 137, 157, 114, 134, 154, 174,
+  77, 97, 117, 137, 94, 114, 134, 154, 111, 131, 151, 171, 128, 148, 168, 188,
+  46, 66, 86, 106, 63, 83, 103, 123, 80, 100, 120, 140, 97, 117, 137, 157,
+  60, 80, 100, 120, 77, 97, 117, 137, 94, 114, 134, 154, 111, 131, 151, 171,
+  74, 94, 114, 134, 91, 111, 131, 151, 108, 128, 148, 168, 125, 145, 165, 185,
+  88, 108, 128, 148, 105, 125, 145, 165, 122, 142, 162, 182, 139, 159, 179, 199,
+  57, 77, 97, 117, 74, 94, 114, 134, 91, 111, 131, 151, 108, 128, 148, 168,
+  71, 91, 111, 131, 88, 108, 128, 148, 105, 125, 145, 165, 122, 142, 162, 182,
+  85, 105, 125, 145, 102, 122, 142, 162, 119, 139, 159, 179, 136, 156, 176, 196,
+  99, 119, 139, 159, 116, 136, 156, 176, 133, 153, 173, 193, 150, 170, 190, 210,
+  68, 88, 108, 128, 85, 105, 125, 145, 102, 122, 142, 162, 119, 139, 159, 179,
+  82, 102, 122, 142, 99, 119, 139, 159, 116, 136, 156, 176, 133, 153, 173, 193,
+  96, 116, 136, 156, 113, 133, 153, 173, 130, 150, 170, 190, 147, 167, 187, 207,
+  110, 130, 150, 170, 127, 147, 167, 187, 144, 164, 184, 204, 161, 181, 201, 221,
+  46, 66, 86, 106, 63, 83, 103, 123, 80, 100, 120, 140, 97, 117, 137, 157,
+  60, 80, 100, 120, 77, 97, 117, 137, 94, 114, 134, 154, 111, 131, 151, 171,
+  74, 94, 114, 134, 91, 111, 131, 151, 108, 128, 148, 168, 125, 145, 165, 185,
+  88, 108, 128, 148, 105, 125, 145, 165, 122, 142, 162, 182, 139, 159, 179, 199,
+  57, 77, 97, 117, 74, 94, 114, 134, 91, 111, 131, 151, 108, 128, 148, 168,
+  71, 91, 111, 131, 88, 108, 128, 148, 105, 125, 145, 165, 122, 142, 162, 182,
+  85, 105, 125, 145, 102, 122, 142, 162, 119, 139, 159, 179, 136, 156, 176, 196,
+  99, 119, 139, 159, 116, 136, 156, 176, 133, 153, 173, 193, 150, 170, 190, 210,
+  68, 88, 108, 128, 85, 105, 125, 145, 102, 122, 142, 162, 119, 139, 159, 179,
+  82, 102, 122, 142, 99, 119, 139, 159, 116, 136, 156, 176, 133, 153, 173, 193,
+  96, 116, 136, 156, 113, 133, 153, 173, 130, 150, 170, 190, 147, 167, 187, 207,
+  110, 130, 150, 170, 127, 147, 167, 187, 144, 164, 184, 204, 161, 181, 201, 221,
+  79, 99, 119, 139, 96, 116, 136, 156, 113, 133, 153, 173, 130, 150, 170, 190,
+  93, 113, 133, 153, 110, 130, 150, 170, 127, 147, 167, 187, 144, 164, 184, 204,
+  107, 127, 147, 167, 124, 144, 164, 184, 141, 161, 181, 201, 158, 178, 198, 218,
+  121, 141, 161, 181, 138, 158, 178, 198, 155, 175, 195, 215, 172, 192, 212, 232,
+};
+
+const guint8 BID_PLAIN_LANE[MELD_LANE_PATTERNS] = {
+  0, 15, 31, 45, 9, 27, 37, 55, 21, 34, 39, 65, 9, 31, 53, 75,
+  6, 23, 37, 47, 16, 32, 38, 57, 25, 35, 38, 67, 11, 33, 55, 77,
+  12, 29, 38, 49, 22, 34, 36, 59, 26, 34, 35, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  2, 16, 31, 45, 10, 27, 35, 55, 20, 32, 35, 65, 9, 31, 53, 75,
+  6, 23, 34, 47, 14, 29, 33, 57, 22, 31, 33, 67, 11, 33, 55, 77,
+  10, 26, 32, 49, 18, 29, 32, 59, 22, 29, 31, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  2, 17, 29, 45, 9, 25, 32, 55, 18, 30, 31, 65, 9, 31, 53, 75,
+  5, 21, 30, 47, 13, 27, 30, 57, 18, 28, 31, 67, 11, 33, 55, 77,
+  9, 23, 30, 49, 16, 26, 29, 59, 18, 26, 40, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  2, 16, 31, 45, 9, 27, 34, 55, 20, 32, 35, 65, 9, 31, 53, 75,
+  5, 23, 34, 47, 14, 29, 33, 57, 21, 31, 33, 67, 11, 33, 55, 77,
+  10, 25, 33, 49, 18, 29, 31, 59, 22, 29, 29, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  2, 16, 29, 45, 9, 25, 31, 55, 17, 29, 31, 65, 9, 31, 53, 75,
+  5, 21, 30, 47, 12, 26, 28, 57, 18, 27, 28, 67, 11, 33, 55, 77,
+  8, 23, 28, 49, 15, 26, 27, 59, 17, 26, 26, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  2, 15, 27, 45, 9, 24, 29, 55, 16, 26, 28, 65, 9, 31, 53, 75,
+  5, 20, 28, 47, 12, 25, 26, 57, 16, 26, 30, 67, 11, 33, 55, 77,
+  8, 22, 31, 49, 14, 23, 22, 59, 16, 22, 34, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  2, 16, 28, 45, 9, 25, 30, 55, 17, 28, 32, 65, 9, 31, 53, 75,
+  5, 21, 30, 47, 12, 26, 29, 57, 18, 28, 29, 67, 11, 33, 55, 77,
+  8, 23, 28, 49, 16, 26, 25, 59, 18, 27, 22, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  2, 15, 27, 45, 8, 24, 28, 55, 16, 26, 28, 65, 9, 31, 53, 75,
+  5, 20, 27, 47, 12, 25, 27, 57, 16, 24, 28, 67, 11, 33, 55, 77,
+  8, 21, 23, 49, 14, 21, 21, 59, 15, 25, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  3, 16, 26, 45, 9, 23, 28, 55, 17, 26, 33, 65, 9, 31, 53, 75,
+  5, 19, 28, 47, 12, 22, 28, 57, 18, 24, 38, 67, 11, 33, 55, 77,
+  8, 18, 26, 49, 12, 25, 35, 59, 9, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  1, 15, 30, 45, 8, 26, 34, 55, 19, 31, 34, 65, 9, 31, 53, 75,
+  5, 22, 33, 47, 13, 29, 32, 57, 20, 30, 32, 67, 11, 33, 55, 77,
+  9, 24, 32, 49, 17, 28, 31, 59, 21, 28, 29, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  1, 15, 28, 45, 8, 24, 30, 55, 16, 28, 31, 65, 9, 31, 53, 75,
+  4, 20, 29, 47, 11, 26, 29, 57, 17, 27, 27, 67, 11, 33, 55, 77,
+  7, 22, 27, 49, 14, 25, 27, 59, 16, 25, 27, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  1, 15, 26, 45, 8, 23, 28, 55, 15, 26, 28, 65, 9, 31, 53, 75,
+  4, 19, 26, 47, 11, 24, 25, 57, 16, 23, 21, 67, 11, 33, 55, 77,
+  7, 21, 27, 49, 14, 22, 27, 59, 16, 24, 39, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  1, 15, 28, 45, 8, 24, 30, 55, 16, 28, 30, 65, 9, 31, 53, 75,
+  4, 20, 29, 47, 11, 25, 27, 57, 17, 25, 27, 67, 11, 33, 55, 77,
+  7, 21, 27, 49, 14, 25, 25, 59, 17, 23, 21, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  1, 14, 26, 45, 7, 23, 27, 55, 15, 26, 26, 65, 9, 31, 53, 75,
+  4, 19, 26, 47, 10, 23, 25, 57, 15, 23, 23, 67, 11, 33, 55, 77,
+  6, 20, 24, 49, 13, 22, 23, 59, 13, 19, 40, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  2, 14, 24, 45, 8, 22, 25, 55, 14, 24, 22, 65, 9, 31, 53, 75,
+  4, 19, 25, 47, 10, 22, 19, 57, 13, 16, 28, 67, 11, 33, 55, 77,
+  7, 18, 18, 49, 10, 17, 25, 59, 13, 21, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  1, 14, 25, 45, 7, 22, 27, 55, 14, 24, 28, 65, 9, 31, 53, 75,
+  3, 18, 27, 47, 10, 24, 26, 57, 15, 24, 25, 67, 11, 33, 55, 77,
+  7, 20, 23, 49, 13, 21, 22, 59, 13, 14, 36, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  2, 14, 24, 45, 7, 22, 23, 55, 13, 24, 30, 65, 9, 31, 53, 75,
+  4, 18, 24, 47, 10, 21, 22, 57, 13, 20, 24, 67, 11, 33, 55, 77,
+  7, 17, 18, 49, 11, 19, 28, 59, 9, 17, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  3, 15, 23, 45, 8, 20, 25, 55, 16, 18, 47, 65, 9, 31, 53, 75,
+  5, 18, 23, 47, 9, 21, 35, 57, 13, 26, 52, 67, 11, 33, 55, 77,
+  6, 14, 25, 49, 9, 18, 44, 59, 14, 23, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  1, 14, 27, 45, 7, 23, 29, 55, 15, 28, 30, 65, 9, 31, 53, 75,
+  3, 19, 28, 47, 11, 24, 27, 57, 17, 26, 23, 67, 11, 33, 55, 77,
+  6, 21, 27, 49, 14, 25, 25, 59, 16, 23, 26, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  1, 14, 26, 45, 7, 22, 28, 55, 15, 25, 27, 65, 9, 31, 53, 75,
+  3, 18, 26, 47, 10, 24, 24, 57, 15, 23, 25, 67, 11, 33, 55, 77,
+  6, 20, 26, 49, 12, 22, 18, 59, 16, 18, 37, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  2, 14, 24, 45, 8, 21, 25, 55, 14, 24, 38, 65, 9, 31, 53, 75,
+  4, 19, 23, 47, 10, 22, 21, 57, 16, 19, 29, 67, 11, 33, 55, 77,
+  6, 17, 23, 49, 9, 18, 40, 59, 16, 23, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  1, 14, 26, 45, 7, 22, 27, 55, 14, 25, 27, 65, 9, 31, 53, 75,
+  3, 19, 25, 47, 10, 24, 24, 57, 14, 22, 21, 67, 11, 33, 55, 77,
+  6, 19, 27, 49, 12, 21, 20, 59, 14, 22, 37, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  2, 14, 23, 45, 7, 21, 24, 55, 13, 23, 24, 65, 9, 31, 53, 75,
+  4, 18, 24, 47, 10, 22, 22, 57, 13, 21, 31, 67, 11, 33, 55, 77,
+  6, 18, 23, 49, 9, 19, 29, 59, 8, 25, 41, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  2, 14, 21, 45, 7, 20, 30, 55, 16, 21, 49, 65, 9, 31, 53, 75,
+  4, 17, 23, 47, 10, 19, 26, 57, 10, 20, 52, 67, 11, 33, 55, 77,
+  6, 14, 26, 49, 9, 16, 32, 59, 7, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  1, 14, 25, 45, 7, 21, 23, 55, 14, 19, 34, 65, 9, 31, 53, 75,
+  3, 17, 22, 47, 10, 19, 18, 57, 12, 18, 30, 67, 11, 33, 55, 77,
+  6, 17, 21, 49, 12, 21, 35, 59, 14, 18, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  2, 14, 22, 45, 7, 21, 19, 55, 11, 20, 34, 65, 9, 31, 53, 75,
+  4, 16, 23, 47, 9, 23, 12, 57, 8, 17, 52, 67, 11, 33, 55, 77,
+  6, 12, 25, 49, 8, 29, 33, 59, 6, 23, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  2, 16, 19, 45, 7, 23, 25, 55, 6, 22, 50, 65, 9, 31, 53, 75,
+  4, 17, 29, 47, 8, 16, 42, 57, 4, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 5, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+  0, 15, 30, 45, 3, 25, 40, 55, 6, 28, 50, 65, 9, 31, 53, 75,
+  2, 17, 32, 47, 5, 27, 42, 57, 8, 30, 52, 67, 11, 33, 55, 77,
+  4, 19, 34, 49, 7, 29, 44, 59, 10, 32, 54, 69, 13, 35, 57, 79,
+  6, 21, 36, 51, 9, 31, 46, 61, 12, 34, 56, 71, 15, 37, 59, 81,
+};
@@ -0,0 +1,1295 @@
+/* generated by `console meld-table`; do not edit. */
+
+const struct meld_trump_lane MELD_TRUMP_LANE[MELD_LANE_PATTERNS] = {
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 },
+  { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 },
+  { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 },
+  { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 },
+  { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 },
+  { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 },
+  { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 },
+  { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 },
+  { 0, 4, 0 }, { 0, 4, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 },
+  { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 },
+  { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 8, 0 }, { 0, 8, 0 },
+  { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 },
+  { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 },
+  { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 },
+  { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 },
+  { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 4, 0 }, { 0, 4, 0 },
+  { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 },
+  { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 },
+  { 0, 4, 0 }, { 0, 4, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 },
+  { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 },
+  { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 },
+  { 0, 12, 0 }, { 0, 12, 0 }, { 0, 12, 0 }, { 0, 12, 0 }, { 0, 12, 0 }, { 0, 12, 0 },
+  { 0, 12, 0 }, { 0, 12, 0 }, { 0, 12, 0 }, { 0, 12, 0 }, { 0, 12, 0 }, { 0, 12, 0 },
+  { 0, 12, 0 }, { 0, 12, 0 }, { 0, 12, 0 }, { 0, 12, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 15, 0, 0 },
+  { 15, 0, 0 }, { 15, 0, 0 }, { 0, 4, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 15, 0, 0 },
+  { 0, 4, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 0, 4, 0 }, { 0, 4, 0 },
+  { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 15, 0, 0 },
+  { 0, 4, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 0, 4, 0 }, { 15, 0, 0 },
+  { 15, 0, 0 }, { 15, 0, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 },
+  { 0, 4, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 0, 4, 0 }, { 15, 0, 0 },
+  { 15, 0, 0 }, { 15, 0, 0 }, { 0, 4, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 15, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 4, 0 }, { 0, 4, 0 },
+  { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 15, 0, 0 },
+  { 0, 4, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 0, 4, 0 }, { 15, 0, 0 },
+  { 15, 0, 0 }, { 15, 0, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 },
+  { 0, 8, 0 }, { 15, 4, 0 }, { 15, 4, 0 }, { 15, 4, 0 }, { 0, 8, 0 }, { 15, 4, 0 },
+  { 15, 4, 0 }, { 15, 4, 0 }, { 0, 8, 0 }, { 15, 4, 0 }, { 15, 4, 0 }, { 15, 4, 0 },
+  { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 15, 4, 0 },
+  { 15, 4, 0 }, { 15, 4, 0 }, { 0, 8, 0 }, { 15, 4, 0 }, { 15, 4, 0 }, { 15, 4, 0 },
+  { 0, 8, 0 }, { 15, 4, 0 }, { 15, 4, 0 }, { 15, 4, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 },
+  { 0, 4, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 0, 4, 0 }, { 15, 0, 0 },
+  { 15, 0, 0 }, { 15, 0, 0 }, { 0, 4, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 15, 0, 0 },
+  { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 15, 4, 0 },
+  { 15, 4, 0 }, { 15, 4, 0 }, { 0, 8, 0 }, { 15, 4, 0 }, { 15, 4, 0 }, { 15, 4, 0 },
+  { 0, 8, 0 }, { 15, 4, 0 }, { 15, 4, 0 }, { 15, 4, 0 }, { 0, 12, 0 }, { 0, 12, 0 },
+  { 0, 12, 0 }, { 0, 12, 0 }, { 0, 12, 0 }, { 15, 8, 0 }, { 15, 8, 0 }, { 15, 8, 0 },
+  { 0, 12, 0 }, { 15, 8, 0 }, { 15, 8, 0 }, { 15, 8, 0 }, { 0, 12, 0 }, { 15, 8, 0 },
+  { 15, 8, 0 }, { 15, 8, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 4, 0 }, { 0, 4, 0 },
+  { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 15, 0, 0 },
+  { 0, 4, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 0, 4, 0 }, { 15, 0, 0 },
+  { 15, 0, 0 }, { 15, 0, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 },
+  { 0, 4, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 0, 4, 0 }, { 15, 0, 0 },
+  { 15, 0, 0 }, { 15, 0, 0 }, { 0, 4, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 15, 0, 0 },
+  { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 15, 0, 0 },
+  { 15, 0, 0 }, { 15, 0, 0 }, { 0, 4, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 15, 0, 0 },
+  { 0, 4, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 },
+  { 0, 4, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 0, 4, 0 }, { 15, 0, 0 },
+  { 15, 0, 0 }, { 15, 0, 0 }, { 0, 4, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 15, 0, 0 },
+  { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 15, 4, 0 },
+  { 15, 4, 0 }, { 15, 4, 0 }, { 0, 8, 0 }, { 15, 4, 0 }, { 150, 0, 0 }, { 150, 0, 0 },
+  { 0, 8, 0 }, { 15, 4, 0 }, { 150, 0, 0 }, { 150, 0, 0 }, { 0, 8, 0 }, { 0, 8, 0 },
+  { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 15, 4, 0 }, { 15, 4, 0 }, { 15, 4, 0 },
+  { 0, 8, 0 }, { 15, 4, 0 }, { 150, 0, 0 }, { 150, 0, 0 }, { 0, 8, 0 }, { 15, 4, 0 },
+  { 150, 0, 0 }, { 150, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 15, 0, 0 },
+  { 15, 0, 0 }, { 15, 0, 0 }, { 0, 4, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 15, 0, 0 },
+  { 0, 4, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 0, 8, 0 }, { 0, 8, 0 },
+  { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 15, 4, 0 }, { 15, 4, 0 }, { 15, 4, 0 },
+  { 0, 8, 0 }, { 15, 4, 0 }, { 150, 0, 0 }, { 150, 0, 0 }, { 0, 8, 0 }, { 15, 4, 0 },
+  { 150, 0, 0 }, { 150, 0, 0 }, { 0, 12, 0 }, { 0, 12, 0 }, { 0, 12, 0 }, { 0, 12, 0 },
+  { 0, 12, 0 }, { 15, 8, 0 }, { 15, 8, 0 }, { 15, 8, 0 }, { 0, 12, 0 }, { 15, 8, 0 },
+  { 150, 4, 0 }, { 150, 4, 0 }, { 0, 12, 0 }, { 15, 8, 0 }, { 150, 4, 0 }, { 150, 4, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 },
+  { 0, 4, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 0, 4, 0 }, { 15, 0, 0 },
+  { 15, 0, 0 }, { 15, 0, 0 }, { 0, 4, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 15, 0, 0 },
+  { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 15, 0, 0 },
+  { 15, 0, 0 }, { 15, 0, 0 }, { 0, 4, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 15, 0, 0 },
+  { 0, 4, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 0, 4, 0 }, { 0, 4, 0 },
+  { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 15, 0, 0 },
+  { 0, 4, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 0, 4, 0 }, { 15, 0, 0 },
+  { 15, 0, 0 }, { 15, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 15, 0, 0 },
+  { 15, 0, 0 }, { 15, 0, 0 }, { 0, 4, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 15, 0, 0 },
+  { 0, 4, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 0, 8, 0 }, { 0, 8, 0 },
+  { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 15, 4, 0 }, { 15, 4, 0 }, { 15, 4, 0 },
+  { 0, 8, 0 }, { 15, 4, 0 }, { 150, 0, 0 }, { 150, 0, 0 }, { 0, 8, 0 }, { 15, 4, 0 },
+  { 150, 0, 0 }, { 150, 0, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 },
+  { 0, 8, 0 }, { 15, 4, 0 }, { 15, 4, 0 }, { 15, 4, 0 }, { 0, 8, 0 }, { 15, 4, 0 },
+  { 150, 0, 0 }, { 150, 0, 0 }, { 0, 8, 0 }, { 15, 4, 0 }, { 150, 0, 0 }, { 150, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 },
+  { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 4, 0 }, { 0, 4, 0 },
+  { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 15, 0, 0 },
+  { 0, 4, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 15, 0, 0 }, { 0, 4, 0 }, { 15, 0, 0 },
+  { 15, 0, 0 }, { 15, 0, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 }, { 0, 8, 0 },
+  { 0, 8, 0 }, { 15, 4, 0 }, { 15, 4, 0 }, { 15, 4, 0 }, { 0, 8, 0 }, { 15, 4, 0 },
+  { 150, 0, 0 }, { 150, 0, 0 }, { 0, 8, 0 }, { 15, 4, 0 }, { 150, 0, 0 }, { 150, 0, 0 },
+  { 0, 12, 0 }, { 0, 12, 0 }, { 0, 12, 0 }, { 0, 12, 0 }, { 0, 12, 0 }, { 15, 8, 0 },
+  { 15, 8, 0 }, { 15, 8, 0 }, { 0, 12, 0 }, { 15, 8, 0 }, { 150, 4, 0 }, { 150, 4, 0 },
+  { 0, 12, 0 }, { 15, 8, 0 }, { 150, 4, 0 }, { 165, 0, 0 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 },
+  { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 },
+  { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 },
+  { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 },
+  { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 },
+  { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 },
+  { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 },
+  { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 4, 1 }, { 0, 4, 1 },
+  { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 },
+  { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 },
+  { 0, 4, 1 }, { 0, 4, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 },
+  { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 },
+  { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 },
+  { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 },
+  { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 },
+  { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 },
+  { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 },
+  { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 },
+  { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 },
+  { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 },
+  { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 12, 1 }, { 0, 12, 1 },
+  { 0, 12, 1 }, { 0, 12, 1 }, { 0, 12, 1 }, { 0, 12, 1 }, { 0, 12, 1 }, { 0, 12, 1 },
+  { 0, 12, 1 }, { 0, 12, 1 }, { 0, 12, 1 }, { 0, 12, 1 }, { 0, 12, 1 }, { 0, 12, 1 },
+  { 0, 12, 1 }, { 0, 12, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 4, 1 }, { 0, 4, 1 },
+  { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 15, 0, 1 },
+  { 0, 4, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 0, 4, 1 }, { 15, 0, 1 },
+  { 15, 0, 1 }, { 15, 0, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 },
+  { 0, 4, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 0, 4, 1 }, { 15, 0, 1 },
+  { 15, 0, 1 }, { 15, 0, 1 }, { 0, 4, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 15, 0, 1 },
+  { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 15, 0, 1 },
+  { 15, 0, 1 }, { 15, 0, 1 }, { 0, 4, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 15, 0, 1 },
+  { 0, 4, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 },
+  { 0, 4, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 0, 4, 1 }, { 15, 0, 1 },
+  { 15, 0, 1 }, { 15, 0, 1 }, { 0, 4, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 15, 0, 1 },
+  { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 15, 4, 1 },
+  { 15, 4, 1 }, { 15, 4, 1 }, { 0, 8, 1 }, { 15, 4, 1 }, { 15, 4, 1 }, { 15, 4, 1 },
+  { 0, 8, 1 }, { 15, 4, 1 }, { 15, 4, 1 }, { 15, 4, 1 }, { 0, 8, 1 }, { 0, 8, 1 },
+  { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 15, 4, 1 }, { 15, 4, 1 }, { 15, 4, 1 },
+  { 0, 8, 1 }, { 15, 4, 1 }, { 15, 4, 1 }, { 15, 4, 1 }, { 0, 8, 1 }, { 15, 4, 1 },
+  { 15, 4, 1 }, { 15, 4, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 15, 0, 1 },
+  { 15, 0, 1 }, { 15, 0, 1 }, { 0, 4, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 15, 0, 1 },
+  { 0, 4, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 0, 8, 1 }, { 0, 8, 1 },
+  { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 15, 4, 1 }, { 15, 4, 1 }, { 15, 4, 1 },
+  { 0, 8, 1 }, { 15, 4, 1 }, { 15, 4, 1 }, { 15, 4, 1 }, { 0, 8, 1 }, { 15, 4, 1 },
+  { 15, 4, 1 }, { 15, 4, 1 }, { 0, 12, 1 }, { 0, 12, 1 }, { 0, 12, 1 }, { 0, 12, 1 },
+  { 0, 12, 1 }, { 15, 8, 1 }, { 15, 8, 1 }, { 15, 8, 1 }, { 0, 12, 1 }, { 15, 8, 1 },
+  { 15, 8, 1 }, { 15, 8, 1 }, { 0, 12, 1 }, { 15, 8, 1 }, { 15, 8, 1 }, { 15, 8, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 },
+  { 0, 4, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 0, 4, 1 }, { 15, 0, 1 },
+  { 15, 0, 1 }, { 15, 0, 1 }, { 0, 4, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 15, 0, 1 },
+  { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 15, 0, 1 },
+  { 15, 0, 1 }, { 15, 0, 1 }, { 0, 4, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 15, 0, 1 },
+  { 0, 4, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 0, 4, 1 }, { 0, 4, 1 },
+  { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 15, 0, 1 },
+  { 0, 4, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 0, 4, 1 }, { 15, 0, 1 },
+  { 15, 0, 1 }, { 15, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 15, 0, 1 },
+  { 15, 0, 1 }, { 15, 0, 1 }, { 0, 4, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 15, 0, 1 },
+  { 0, 4, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 0, 8, 1 }, { 0, 8, 1 },
+  { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 15, 4, 1 }, { 15, 4, 1 }, { 15, 4, 1 },
+  { 0, 8, 1 }, { 15, 4, 1 }, { 150, 0, 1 }, { 150, 0, 1 }, { 0, 8, 1 }, { 15, 4, 1 },
+  { 150, 0, 1 }, { 150, 0, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 },
+  { 0, 8, 1 }, { 15, 4, 1 }, { 15, 4, 1 }, { 15, 4, 1 }, { 0, 8, 1 }, { 15, 4, 1 },
+  { 150, 0, 1 }, { 150, 0, 1 }, { 0, 8, 1 }, { 15, 4, 1 }, { 150, 0, 1 }, { 150, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 4, 1 }, { 0, 4, 1 },
+  { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 15, 0, 1 },
+  { 0, 4, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 0, 4, 1 }, { 15, 0, 1 },
+  { 15, 0, 1 }, { 15, 0, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 },
+  { 0, 8, 1 }, { 15, 4, 1 }, { 15, 4, 1 }, { 15, 4, 1 }, { 0, 8, 1 }, { 15, 4, 1 },
+  { 150, 0, 1 }, { 150, 0, 1 }, { 0, 8, 1 }, { 15, 4, 1 }, { 150, 0, 1 }, { 150, 0, 1 },
+  { 0, 12, 1 }, { 0, 12, 1 }, { 0, 12, 1 }, { 0, 12, 1 }, { 0, 12, 1 }, { 15, 8, 1 },
+  { 15, 8, 1 }, { 15, 8, 1 }, { 0, 12, 1 }, { 15, 8, 1 }, { 150, 4, 1 }, { 150, 4, 1 },
+  { 0, 12, 1 }, { 15, 8, 1 }, { 150, 4, 1 }, { 150, 4, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 15, 0, 1 },
+  { 15, 0, 1 }, { 15, 0, 1 }, { 0, 4, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 15, 0, 1 },
+  { 0, 4, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 0, 4, 1 }, { 0, 4, 1 },
+  { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 15, 0, 1 },
+  { 0, 4, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 0, 4, 1 }, { 15, 0, 1 },
+  { 15, 0, 1 }, { 15, 0, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 },
+  { 0, 4, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 0, 4, 1 }, { 15, 0, 1 },
+  { 15, 0, 1 }, { 15, 0, 1 }, { 0, 4, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 15, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 4, 1 }, { 0, 4, 1 },
+  { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 15, 0, 1 },
+  { 0, 4, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 0, 4, 1 }, { 15, 0, 1 },
+  { 15, 0, 1 }, { 15, 0, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 },
+  { 0, 8, 1 }, { 15, 4, 1 }, { 15, 4, 1 }, { 15, 4, 1 }, { 0, 8, 1 }, { 15, 4, 1 },
+  { 150, 0, 1 }, { 150, 0, 1 }, { 0, 8, 1 }, { 15, 4, 1 }, { 150, 0, 1 }, { 150, 0, 1 },
+  { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 15, 4, 1 },
+  { 15, 4, 1 }, { 15, 4, 1 }, { 0, 8, 1 }, { 15, 4, 1 }, { 150, 0, 1 }, { 150, 0, 1 },
+  { 0, 8, 1 }, { 15, 4, 1 }, { 150, 0, 1 }, { 150, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 },
+  { 0, 0, 1 }, { 0, 0, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 }, { 0, 4, 1 },
+  { 0, 4, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 0, 4, 1 }, { 15, 0, 1 },
+  { 15, 0, 1 }, { 15, 0, 1 }, { 0, 4, 1 }, { 15, 0, 1 }, { 15, 0, 1 }, { 15, 0, 1 },
+  { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 0, 8, 1 }, { 15, 4, 1 },
+  { 15, 4, 1 }, { 15, 4, 1 }, { 0, 8, 1 }, { 15, 4, 1 }, { 150, 0, 1 }, { 150, 0, 1 },
+  { 0, 8, 1 }, { 15, 4, 1 }, { 150, 0, 1 }, { 150, 0, 1 }, { 0, 12, 1 }, { 0, 12, 1 },
+  { 0, 12, 1 }, { 0, 12, 1 }, { 0, 12, 1 }, { 15, 8, 1 }, { 15, 8, 1 }, { 15, 8, 1 },
+  { 0, 12, 1 }, { 15, 8, 1 }, { 150, 4, 1 }, { 150, 4, 1 }, { 0, 12, 1 }, { 15, 8, 1 },
+  { 150, 4, 1 }, { 165, 0, 1 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 4, 2 }, { 0, 4, 2 },
+  { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 },
+  { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 },
+  { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 },
+  { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 },
+  { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 },
+  { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 },
+  { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 },
+  { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 },
+  { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 },
+  { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 },
+  { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 },
+  { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 },
+  { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 },
+  { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 },
+  { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 },
+  { 0, 8, 2 }, { 0, 8, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 },
+  { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 },
+  { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 8, 2 }, { 0, 8, 2 },
+  { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 },
+  { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 },
+  { 0, 8, 2 }, { 0, 8, 2 }, { 0, 12, 2 }, { 0, 12, 2 }, { 0, 12, 2 }, { 0, 12, 2 },
+  { 0, 12, 2 }, { 0, 12, 2 }, { 0, 12, 2 }, { 0, 12, 2 }, { 0, 12, 2 }, { 0, 12, 2 },
+  { 0, 12, 2 }, { 0, 12, 2 }, { 0, 12, 2 }, { 0, 12, 2 }, { 0, 12, 2 }, { 0, 12, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 },
+  { 0, 4, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 0, 4, 2 }, { 15, 0, 2 },
+  { 15, 0, 2 }, { 15, 0, 2 }, { 0, 4, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 15, 0, 2 },
+  { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 15, 0, 2 },
+  { 15, 0, 2 }, { 15, 0, 2 }, { 0, 4, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 15, 0, 2 },
+  { 0, 4, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 0, 4, 2 }, { 0, 4, 2 },
+  { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 15, 0, 2 },
+  { 0, 4, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 0, 4, 2 }, { 15, 0, 2 },
+  { 15, 0, 2 }, { 15, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 15, 0, 2 },
+  { 15, 0, 2 }, { 15, 0, 2 }, { 0, 4, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 15, 0, 2 },
+  { 0, 4, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 0, 8, 2 }, { 0, 8, 2 },
+  { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 15, 4, 2 }, { 15, 4, 2 }, { 15, 4, 2 },
+  { 0, 8, 2 }, { 15, 4, 2 }, { 15, 4, 2 }, { 15, 4, 2 }, { 0, 8, 2 }, { 15, 4, 2 },
+  { 15, 4, 2 }, { 15, 4, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 },
+  { 0, 8, 2 }, { 15, 4, 2 }, { 15, 4, 2 }, { 15, 4, 2 }, { 0, 8, 2 }, { 15, 4, 2 },
+  { 15, 4, 2 }, { 15, 4, 2 }, { 0, 8, 2 }, { 15, 4, 2 }, { 15, 4, 2 }, { 15, 4, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 4, 2 }, { 0, 4, 2 },
+  { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 15, 0, 2 },
+  { 0, 4, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 0, 4, 2 }, { 15, 0, 2 },
+  { 15, 0, 2 }, { 15, 0, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 },
+  { 0, 8, 2 }, { 15, 4, 2 }, { 15, 4, 2 }, { 15, 4, 2 }, { 0, 8, 2 }, { 15, 4, 2 },
+  { 15, 4, 2 }, { 15, 4, 2 }, { 0, 8, 2 }, { 15, 4, 2 }, { 15, 4, 2 }, { 15, 4, 2 },
+  { 0, 12, 2 }, { 0, 12, 2 }, { 0, 12, 2 }, { 0, 12, 2 }, { 0, 12, 2 }, { 15, 8, 2 },
+  { 15, 8, 2 }, { 15, 8, 2 }, { 0, 12, 2 }, { 15, 8, 2 }, { 15, 8, 2 }, { 15, 8, 2 },
+  { 0, 12, 2 }, { 15, 8, 2 }, { 15, 8, 2 }, { 15, 8, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 15, 0, 2 },
+  { 15, 0, 2 }, { 15, 0, 2 }, { 0, 4, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 15, 0, 2 },
+  { 0, 4, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 0, 4, 2 }, { 0, 4, 2 },
+  { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 15, 0, 2 },
+  { 0, 4, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 0, 4, 2 }, { 15, 0, 2 },
+  { 15, 0, 2 }, { 15, 0, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 },
+  { 0, 4, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 0, 4, 2 }, { 15, 0, 2 },
+  { 15, 0, 2 }, { 15, 0, 2 }, { 0, 4, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 15, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 4, 2 }, { 0, 4, 2 },
+  { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 15, 0, 2 },
+  { 0, 4, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 0, 4, 2 }, { 15, 0, 2 },
+  { 15, 0, 2 }, { 15, 0, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 },
+  { 0, 8, 2 }, { 15, 4, 2 }, { 15, 4, 2 }, { 15, 4, 2 }, { 0, 8, 2 }, { 15, 4, 2 },
+  { 150, 0, 2 }, { 150, 0, 2 }, { 0, 8, 2 }, { 15, 4, 2 }, { 150, 0, 2 }, { 150, 0, 2 },
+  { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 15, 4, 2 },
+  { 15, 4, 2 }, { 15, 4, 2 }, { 0, 8, 2 }, { 15, 4, 2 }, { 150, 0, 2 }, { 150, 0, 2 },
+  { 0, 8, 2 }, { 15, 4, 2 }, { 150, 0, 2 }, { 150, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 },
+  { 0, 4, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 0, 4, 2 }, { 15, 0, 2 },
+  { 15, 0, 2 }, { 15, 0, 2 }, { 0, 4, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 15, 0, 2 },
+  { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 15, 4, 2 },
+  { 15, 4, 2 }, { 15, 4, 2 }, { 0, 8, 2 }, { 15, 4, 2 }, { 150, 0, 2 }, { 150, 0, 2 },
+  { 0, 8, 2 }, { 15, 4, 2 }, { 150, 0, 2 }, { 150, 0, 2 }, { 0, 12, 2 }, { 0, 12, 2 },
+  { 0, 12, 2 }, { 0, 12, 2 }, { 0, 12, 2 }, { 15, 8, 2 }, { 15, 8, 2 }, { 15, 8, 2 },
+  { 0, 12, 2 }, { 15, 8, 2 }, { 150, 4, 2 }, { 150, 4, 2 }, { 0, 12, 2 }, { 15, 8, 2 },
+  { 150, 4, 2 }, { 150, 4, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 4, 2 }, { 0, 4, 2 },
+  { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 15, 0, 2 },
+  { 0, 4, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 0, 4, 2 }, { 15, 0, 2 },
+  { 15, 0, 2 }, { 15, 0, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 },
+  { 0, 4, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 0, 4, 2 }, { 15, 0, 2 },
+  { 15, 0, 2 }, { 15, 0, 2 }, { 0, 4, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 15, 0, 2 },
+  { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 15, 0, 2 },
+  { 15, 0, 2 }, { 15, 0, 2 }, { 0, 4, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 15, 0, 2 },
+  { 0, 4, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 },
+  { 0, 4, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 0, 4, 2 }, { 15, 0, 2 },
+  { 15, 0, 2 }, { 15, 0, 2 }, { 0, 4, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 15, 0, 2 },
+  { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 15, 4, 2 },
+  { 15, 4, 2 }, { 15, 4, 2 }, { 0, 8, 2 }, { 15, 4, 2 }, { 150, 0, 2 }, { 150, 0, 2 },
+  { 0, 8, 2 }, { 15, 4, 2 }, { 150, 0, 2 }, { 150, 0, 2 }, { 0, 8, 2 }, { 0, 8, 2 },
+  { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 15, 4, 2 }, { 15, 4, 2 }, { 15, 4, 2 },
+  { 0, 8, 2 }, { 15, 4, 2 }, { 150, 0, 2 }, { 150, 0, 2 }, { 0, 8, 2 }, { 15, 4, 2 },
+  { 150, 0, 2 }, { 150, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 }, { 0, 0, 2 },
+  { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 0, 4, 2 }, { 15, 0, 2 },
+  { 15, 0, 2 }, { 15, 0, 2 }, { 0, 4, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 15, 0, 2 },
+  { 0, 4, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 15, 0, 2 }, { 0, 8, 2 }, { 0, 8, 2 },
+  { 0, 8, 2 }, { 0, 8, 2 }, { 0, 8, 2 }, { 15, 4, 2 }, { 15, 4, 2 }, { 15, 4, 2 },
+  { 0, 8, 2 }, { 15, 4, 2 }, { 150, 0, 2 }, { 150, 0, 2 }, { 0, 8, 2 }, { 15, 4, 2 },
+  { 150, 0, 2 }, { 150, 0, 2 }, { 0, 12, 2 }, { 0, 12, 2 }, { 0, 12, 2 }, { 0, 12, 2 },
+  { 0, 12, 2 }, { 15, 8, 2 }, { 15, 8, 2 }, { 15, 8, 2 }, { 0, 12, 2 }, { 15, 8, 2 },
+  { 150, 4, 2 }, { 150, 4, 2 }, { 0, 12, 2 }, { 15, 8, 2 }, { 150, 4, 2 }, { 165, 0, 2 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 },
+  { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 },
+  { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 },
+  { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 },
+  { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 },
+  { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 },
+  { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 },
+  { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 },
+  { 0, 4, 3 }, { 0, 4, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 },
+  { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 },
+  { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 8, 3 }, { 0, 8, 3 },
+  { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 },
+  { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 },
+  { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 },
+  { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 },
+  { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 4, 3 }, { 0, 4, 3 },
+  { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 },
+  { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 },
+  { 0, 4, 3 }, { 0, 4, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 },
+  { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 },
+  { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 },
+  { 0, 12, 3 }, { 0, 12, 3 }, { 0, 12, 3 }, { 0, 12, 3 }, { 0, 12, 3 }, { 0, 12, 3 },
+  { 0, 12, 3 }, { 0, 12, 3 }, { 0, 12, 3 }, { 0, 12, 3 }, { 0, 12, 3 }, { 0, 12, 3 },
+  { 0, 12, 3 }, { 0, 12, 3 }, { 0, 12, 3 }, { 0, 12, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 15, 0, 3 },
+  { 15, 0, 3 }, { 15, 0, 3 }, { 0, 4, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 15, 0, 3 },
+  { 0, 4, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 0, 4, 3 }, { 0, 4, 3 },
+  { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 15, 0, 3 },
+  { 0, 4, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 0, 4, 3 }, { 15, 0, 3 },
+  { 15, 0, 3 }, { 15, 0, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 },
+  { 0, 4, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 0, 4, 3 }, { 15, 0, 3 },
+  { 15, 0, 3 }, { 15, 0, 3 }, { 0, 4, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 15, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 4, 3 }, { 0, 4, 3 },
+  { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 15, 0, 3 },
+  { 0, 4, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 0, 4, 3 }, { 15, 0, 3 },
+  { 15, 0, 3 }, { 15, 0, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 },
+  { 0, 8, 3 }, { 15, 4, 3 }, { 15, 4, 3 }, { 15, 4, 3 }, { 0, 8, 3 }, { 15, 4, 3 },
+  { 15, 4, 3 }, { 15, 4, 3 }, { 0, 8, 3 }, { 15, 4, 3 }, { 15, 4, 3 }, { 15, 4, 3 },
+  { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 15, 4, 3 },
+  { 15, 4, 3 }, { 15, 4, 3 }, { 0, 8, 3 }, { 15, 4, 3 }, { 15, 4, 3 }, { 15, 4, 3 },
+  { 0, 8, 3 }, { 15, 4, 3 }, { 15, 4, 3 }, { 15, 4, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 },
+  { 0, 4, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 0, 4, 3 }, { 15, 0, 3 },
+  { 15, 0, 3 }, { 15, 0, 3 }, { 0, 4, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 15, 0, 3 },
+  { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 15, 4, 3 },
+  { 15, 4, 3 }, { 15, 4, 3 }, { 0, 8, 3 }, { 15, 4, 3 }, { 15, 4, 3 }, { 15, 4, 3 },
+  { 0, 8, 3 }, { 15, 4, 3 }, { 15, 4, 3 }, { 15, 4, 3 }, { 0, 12, 3 }, { 0, 12, 3 },
+  { 0, 12, 3 }, { 0, 12, 3 }, { 0, 12, 3 }, { 15, 8, 3 }, { 15, 8, 3 }, { 15, 8, 3 },
+  { 0, 12, 3 }, { 15, 8, 3 }, { 15, 8, 3 }, { 15, 8, 3 }, { 0, 12, 3 }, { 15, 8, 3 },
+  { 15, 8, 3 }, { 15, 8, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 4, 3 }, { 0, 4, 3 },
+  { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 15, 0, 3 },
+  { 0, 4, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 0, 4, 3 }, { 15, 0, 3 },
+  { 15, 0, 3 }, { 15, 0, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 },
+  { 0, 4, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 0, 4, 3 }, { 15, 0, 3 },
+  { 15, 0, 3 }, { 15, 0, 3 }, { 0, 4, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 15, 0, 3 },
+  { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 15, 0, 3 },
+  { 15, 0, 3 }, { 15, 0, 3 }, { 0, 4, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 15, 0, 3 },
+  { 0, 4, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 },
+  { 0, 4, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 0, 4, 3 }, { 15, 0, 3 },
+  { 15, 0, 3 }, { 15, 0, 3 }, { 0, 4, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 15, 0, 3 },
+  { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 15, 4, 3 },
+  { 15, 4, 3 }, { 15, 4, 3 }, { 0, 8, 3 }, { 15, 4, 3 }, { 150, 0, 3 }, { 150, 0, 3 },
+  { 0, 8, 3 }, { 15, 4, 3 }, { 150, 0, 3 }, { 150, 0, 3 }, { 0, 8, 3 }, { 0, 8, 3 },
+  { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 15, 4, 3 }, { 15, 4, 3 }, { 15, 4, 3 },
+  { 0, 8, 3 }, { 15, 4, 3 }, { 150, 0, 3 }, { 150, 0, 3 }, { 0, 8, 3 }, { 15, 4, 3 },
+  { 150, 0, 3 }, { 150, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 15, 0, 3 },
+  { 15, 0, 3 }, { 15, 0, 3 }, { 0, 4, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 15, 0, 3 },
+  { 0, 4, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 0, 8, 3 }, { 0, 8, 3 },
+  { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 15, 4, 3 }, { 15, 4, 3 }, { 15, 4, 3 },
+  { 0, 8, 3 }, { 15, 4, 3 }, { 150, 0, 3 }, { 150, 0, 3 }, { 0, 8, 3 }, { 15, 4, 3 },
+  { 150, 0, 3 }, { 150, 0, 3 }, { 0, 12, 3 }, { 0, 12, 3 }, { 0, 12, 3 }, { 0, 12, 3 },
+  { 0, 12, 3 }, { 15, 8, 3 }, { 15, 8, 3 }, { 15, 8, 3 }, { 0, 12, 3 }, { 15, 8, 3 },
+  { 150, 4, 3 }, { 150, 4, 3 }, { 0, 12, 3 }, { 15, 8, 3 }, { 150, 4, 3 }, { 150, 4, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 },
+  { 0, 4, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 0, 4, 3 }, { 15, 0, 3 },
+  { 15, 0, 3 }, { 15, 0, 3 }, { 0, 4, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 15, 0, 3 },
+  { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 15, 0, 3 },
+  { 15, 0, 3 }, { 15, 0, 3 }, { 0, 4, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 15, 0, 3 },
+  { 0, 4, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 0, 4, 3 }, { 0, 4, 3 },
+  { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 15, 0, 3 },
+  { 0, 4, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 0, 4, 3 }, { 15, 0, 3 },
+  { 15, 0, 3 }, { 15, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 15, 0, 3 },
+  { 15, 0, 3 }, { 15, 0, 3 }, { 0, 4, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 15, 0, 3 },
+  { 0, 4, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 0, 8, 3 }, { 0, 8, 3 },
+  { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 15, 4, 3 }, { 15, 4, 3 }, { 15, 4, 3 },
+  { 0, 8, 3 }, { 15, 4, 3 }, { 150, 0, 3 }, { 150, 0, 3 }, { 0, 8, 3 }, { 15, 4, 3 },
+  { 150, 0, 3 }, { 150, 0, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 },
+  { 0, 8, 3 }, { 15, 4, 3 }, { 15, 4, 3 }, { 15, 4, 3 }, { 0, 8, 3 }, { 15, 4, 3 },
+  { 150, 0, 3 }, { 150, 0, 3 }, { 0, 8, 3 }, { 15, 4, 3 }, { 150, 0, 3 }, { 150, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 },
+  { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 0, 3 }, { 0, 4, 3 }, { 0, 4, 3 },
+  { 0, 4, 3 }, { 0, 4, 3 }, { 0, 4, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 15, 0, 3 },
+  { 0, 4, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 15, 0, 3 }, { 0, 4, 3 }, { 15, 0, 3 },
+  { 15, 0, 3 }, { 15, 0, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 }, { 0, 8, 3 },
+  { 0, 8, 3 }, { 15, 4, 3 }, { 15, 4, 3 }, { 15, 4, 3 }, { 0, 8, 3 }, { 15, 4, 3 },
+  { 150, 0, 3 }, { 150, 0, 3 }, { 0, 8, 3 }, { 15, 4, 3 }, { 150, 0, 3 }, { 150, 0, 3 },
+  { 0, 12, 3 }, { 0, 12, 3 }, { 0, 12, 3 }, { 0, 12, 3 }, { 0, 12, 3 }, { 15, 8, 3 },
+  { 15, 8, 3 }, { 15, 8, 3 }, { 0, 12, 3 }, { 15, 8, 3 }, { 150, 4, 3 }, { 150, 4, 3 },
+  { 0, 12, 3 }, { 15, 8, 3 }, { 150, 4, 3 }, { 165, 0, 3 },
+};
+
+const guint8 MELD_PLAIN_LANE[MELD_LANE_PATTERNS] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+};
+
+const guint8 MELD_PINOCHLE[16] = {
+  0, 0, 0, 0, 0, 4, 4, 4, 0, 4, 30, 30, 0, 4, 30, 30,
+};
+
+const guint16 MELD_AROUND[MELD_LANE_PATTERNS] = {
+  0, 10, 0, 100, 0, 10, 0, 100, 0, 10, 0, 100,
+  0, 10, 0, 100, 8, 18, 8, 108, 8, 18, 8, 108,
+  8, 18, 8, 108, 8, 18, 8, 108, 0, 10, 0, 100,
+  0, 10, 0, 100, 0, 10, 0, 100, 0, 10, 0, 100,
+  80, 90, 80, 180, 80, 90, 80, 180, 80, 90, 80, 180,
+  80, 90, 80, 180, 6, 16, 6, 106, 6, 16, 6, 106,
+  6, 16, 6, 106, 6, 16, 6, 106, 14, 24, 14, 114,
+  14, 24, 14, 114, 14, 24, 14, 114, 14, 24, 14, 114,
+  6, 16, 6, 106, 6, 16, 6, 106, 6, 16, 6, 106,
+  6, 16, 6, 106, 86, 96, 86, 186, 86, 96, 86, 186,
+  86, 96, 86, 186, 86, 96, 86, 186, 0, 10, 0, 100,
+  0, 10, 0, 100, 0, 10, 0, 100, 0, 10, 0, 100,
+  8, 18, 8, 108, 8, 18, 8, 108, 8, 18, 8, 108,
+  8, 18, 8, 108, 0, 10, 0, 100, 0, 10, 0, 100,
+  0, 10, 0, 100, 0, 10, 0, 100, 80, 90, 80, 180,
+  80, 90, 80, 180, 80, 90, 80, 180, 80, 90, 80, 180,
+  60, 70, 60, 160, 60, 70, 60, 160, 60, 70, 60, 160,
+  60, 70, 60, 160, 68, 78, 68, 168, 68, 78, 68, 168,
+  68, 78, 68, 168, 68, 78, 68, 168, 60, 70, 60, 160,
+  60, 70, 60, 160, 60, 70, 60, 160, 60, 70, 60, 160,
+  140, 150, 140, 240, 140, 150, 140, 240, 140, 150, 140, 240,
+  140, 150, 140, 240, 4, 14, 4, 104, 4, 14, 4, 104,
+  4, 14, 4, 104, 4, 14, 4, 104, 12, 22, 12, 112,
+  12, 22, 12, 112, 12, 22, 12, 112, 12, 22, 12, 112,
+  4, 14, 4, 104, 4, 14, 4, 104, 4, 14, 4, 104,
+  4, 14, 4, 104, 84, 94, 84, 184, 84, 94, 84, 184,
+  84, 94, 84, 184, 84, 94, 84, 184, 10, 20, 10, 110,
+  10, 20, 10, 110, 10, 20, 10, 110, 10, 20, 10, 110,
+  18, 28, 18, 118, 18, 28, 18, 118, 18, 28, 18, 118,
+  18, 28, 18, 118, 10, 20, 10, 110, 10, 20, 10, 110,
+  10, 20, 10, 110, 10, 20, 10, 110, 90, 100, 90, 190,
+  90, 100, 90, 190, 90, 100, 90, 190, 90, 100, 90, 190,
+  4, 14, 4, 104, 4, 14, 4, 104, 4, 14, 4, 104,
+  4, 14, 4, 104, 12, 22, 12, 112, 12, 22, 12, 112,
+  12, 22, 12, 112, 12, 22, 12, 112, 4, 14, 4, 104,
+  4, 14, 4, 104, 4, 14, 4, 104, 4, 14, 4, 104,
+  84, 94, 84, 184, 84, 94, 84, 184, 84, 94, 84, 184,
+  84, 94, 84, 184, 64, 74, 64, 164, 64, 74, 64, 164,
+  64, 74, 64, 164, 64, 74, 64, 164, 72, 82, 72, 172,
+  72, 82, 72, 172, 72, 82, 72, 172, 72, 82, 72, 172,
+  64, 74, 64, 164, 64, 74, 64, 164, 64, 74, 64, 164,
+  64, 74, 64, 164, 144, 154, 144, 244, 144, 154, 144, 244,
+  144, 154, 144, 244, 144, 154, 144, 244, 0, 10, 0, 100,
+  0, 10, 0, 100, 0, 10, 0, 100, 0, 10, 0, 100,
+  8, 18, 8, 108, 8, 18, 8, 108, 8, 18, 8, 108,
+  8, 18, 8, 108, 0, 10, 0, 100, 0, 10, 0, 100,
+  0, 10, 0, 100, 0, 10, 0, 100, 80, 90, 80, 180,
+  80, 90, 80, 180, 80, 90, 80, 180, 80, 90, 80, 180,
+  6, 16, 6, 106, 6, 16, 6, 106, 6, 16, 6, 106,
+  6, 16, 6, 106, 14, 24, 14, 114, 14, 24, 14, 114,
+  14, 24, 14, 114, 14, 24, 14, 114, 6, 16, 6, 106,
+  6, 16, 6, 106, 6, 16, 6, 106, 6, 16, 6, 106,
+  86, 96, 86, 186, 86, 96, 86, 186, 86, 96, 86, 186,
+  86, 96, 86, 186, 0, 10, 0, 100, 0, 10, 0, 100,
+  0, 10, 0, 100, 0, 10, 0, 100, 8, 18, 8, 108,
+  8, 18, 8, 108, 8, 18, 8, 108, 8, 18, 8, 108,
+  0, 10, 0, 100, 0, 10, 0, 100, 0, 10, 0, 100,
+  0, 10, 0, 100, 80, 90, 80, 180, 80, 90, 80, 180,
+  80, 90, 80, 180, 80, 90, 80, 180, 60, 70, 60, 160,
+  60, 70, 60, 160, 60, 70, 60, 160, 60, 70, 60, 160,
+  68, 78, 68, 168, 68, 78, 68, 168, 68, 78, 68, 168,
+  68, 78, 68, 168, 60, 70, 60, 160, 60, 70, 60, 160,
+  60, 70, 60, 160, 60, 70, 60, 160, 140, 150, 140, 240,
+  140, 150, 140, 240, 140, 150, 140, 240, 140, 150, 140, 240,
+  40, 50, 40, 140, 40, 50, 40, 140, 40, 50, 40, 140,
+  40, 50, 40, 140, 48, 58, 48, 148, 48, 58, 48, 148,
+  48, 58, 48, 148, 48, 58, 48, 148, 40, 50, 40, 140,
+  40, 50, 40, 140, 40, 50, 40, 140, 40, 50, 40, 140,
+  120, 130, 120, 220, 120, 130, 120, 220, 120, 130, 120, 220,
+  120, 130, 120, 220, 46, 56, 46, 146, 46, 56, 46, 146,
+  46, 56, 46, 146, 46, 56, 46, 146, 54, 64, 54, 154,
+  54, 64, 54, 154, 54, 64, 54, 154, 54, 64, 54, 154,
+  46, 56, 46, 146, 46, 56, 46, 146, 46, 56, 46, 146,
+  46, 56, 46, 146, 126, 136, 126, 226, 126, 136, 126, 226,
+  126, 136, 126, 226, 126, 136, 126, 226, 40, 50, 40, 140,
+  40, 50, 40, 140, 40, 50, 40, 140, 40, 50, 40, 140,
+  48, 58, 48, 148, 48, 58, 48, 148, 48, 58, 48, 148,
+  48, 58, 48, 148, 40, 50, 40, 140, 40, 50, 40, 140,
+  40, 50, 40, 140, 40, 50, 40, 140, 120, 130, 120, 220,
+  120, 130, 120, 220, 120, 130, 120, 220, 120, 130, 120, 220,
+  100, 110, 100, 200, 100, 110, 100, 200, 100, 110, 100, 200,
+  100, 110, 100, 200, 108, 118, 108, 208, 108, 118, 108, 208,
+  108, 118, 108, 208, 108, 118, 108, 208, 100, 110, 100, 200,
+  100, 110, 100, 200, 100, 110, 100, 200, 100, 110, 100, 200,
+  180, 190, 180, 280, 180, 190, 180, 280, 180, 190, 180, 280,
+  180, 190, 180, 280, 0, 10, 0, 100, 0, 10, 0, 100,
+  0, 10, 0, 100, 0, 10, 0, 100, 8, 18, 8, 108,
+  8, 18, 8, 108, 8, 18, 8, 108, 8, 18, 8, 108,
+  0, 10, 0, 100, 0, 10, 0, 100, 0, 10, 0, 100,
+  0, 10, 0, 100, 80, 90, 80, 180, 80, 90, 80, 180,
+  80, 90, 80, 180, 80, 90, 80, 180, 6, 16, 6, 106,
+  6, 16, 6, 106, 6, 16, 6, 106, 6, 16, 6, 106,
+  14, 24, 14, 114, 14, 24, 14, 114, 14, 24, 14, 114,
+  14, 24, 14, 114, 6, 16, 6, 106, 6, 16, 6, 106,
+  6, 16, 6, 106, 6, 16, 6, 106, 86, 96, 86, 186,
+  86, 96, 86, 186, 86, 96, 86, 186, 86, 96, 86, 186,
+  0, 10, 0, 100, 0, 10, 0, 100, 0, 10, 0, 100,
+  0, 10, 0, 100, 8, 18, 8, 108, 8, 18, 8, 108,
+  8, 18, 8, 108, 8, 18, 8, 108, 0, 10, 0, 100,
+  0, 10, 0, 100, 0, 10, 0, 100, 0, 10, 0, 100,
+  80, 90, 80, 180, 80, 90, 80, 180, 80, 90, 80, 180,
+  80, 90, 80, 180, 60, 70, 60, 160, 60, 70, 60, 160,
+  60, 70, 60, 160, 60, 70, 60, 160, 68, 78, 68, 168,
+  68, 78, 68, 168, 68, 78, 68, 168, 68, 78, 68, 168,
+  60, 70, 60, 160, 60, 70, 60, 160, 60, 70, 60, 160,
+  60, 70, 60, 160, 140, 150, 140, 240, 140, 150, 140, 240,
+  140, 150, 140, 240, 140, 150, 140, 240, 4, 14, 4, 104,
+  4, 14, 4, 104, 4, 14, 4, 104, 4, 14, 4, 104,
+  12, 22, 12, 112, 12, 22, 12, 112, 12, 22, 12, 112,
+  12, 22, 12, 112, 4, 14, 4, 104, 4, 14, 4, 104,
+  4, 14, 4, 104, 4, 14, 4, 104, 84, 94, 84, 184,
+  84, 94, 84, 184, 84, 94, 84, 184, 84, 94, 84, 184,
+  10, 20, 10, 110, 10, 20, 10, 110, 10, 20, 10, 110,
+  10, 20, 10, 110, 18, 28, 18, 118, 18, 28, 18, 118,
+  18, 28, 18, 118, 18, 28, 18, 118, 10, 20, 10, 110,
+  10, 20, 10, 110, 10, 20, 10, 110, 10, 20, 10, 110,
+  90, 100, 90, 190, 90, 100, 90, 190, 90, 100, 90, 190,
+  90, 100, 90, 190, 4, 14, 4, 104, 4, 14, 4, 104,
+  4, 14, 4, 104, 4, 14, 4, 104, 12, 22, 12, 112,
+  12, 22, 12, 112, 12, 22, 12, 112, 12, 22, 12, 112,
+  4, 14, 4, 104, 4, 14, 4, 104, 4, 14, 4, 104,
+  4, 14, 4, 104, 84, 94, 84, 184, 84, 94, 84, 184,
+  84, 94, 84, 184, 84, 94, 84, 184, 64, 74, 64, 164,
+  64, 74, 64, 164, 64, 74, 64, 164, 64, 74, 64, 164,
+  72, 82, 72, 172, 72, 82, 72, 172, 72, 82, 72, 172,
+  72, 82, 72, 172, 64, 74, 64, 164, 64, 74, 64, 164,
+  64, 74, 64, 164, 64, 74, 64, 164, 144, 154, 144, 244,
+  144, 154, 144, 244, 144, 154, 144, 244, 144, 154, 144, 244,
+  0, 10, 0, 100, 0, 10, 0, 100, 0, 10, 0, 100,
+  0, 10, 0, 100, 8, 18, 8, 108, 8, 18, 8, 108,
+  8, 18, 8, 108, 8, 18, 8, 108, 0, 10, 0, 100,
+  0, 10, 0, 100, 0, 10, 0, 100, 0, 10, 0, 100,
+  80, 90, 80, 180, 80, 90, 80, 180, 80, 90, 80, 180,
+  80, 90, 80, 180, 6, 16, 6, 106, 6, 16, 6, 106,
+  6, 16, 6, 106, 6, 16, 6, 106, 14, 24, 14, 114,
+  14, 24, 14, 114, 14, 24, 14, 114, 14, 24, 14, 114,
+  6, 16, 6, 106, 6, 16, 6, 106, 6, 16, 6, 106,
+  6, 16, 6, 106, 86, 96, 86, 186, 86, 96, 86, 186,
+  86, 96, 86, 186, 86, 96, 86, 186, 0, 10, 0, 100,
+  0, 10, 0, 100, 0, 10, 0, 100, 0, 10, 0, 100,
+  8, 18, 8, 108, 8, 18, 8, 108, 8, 18, 8, 108,
+  8, 18, 8, 108, 0, 10, 0, 100, 0, 10, 0, 100,
+  0, 10, 0, 100, 0, 10, 0, 100, 80, 90, 80, 180,
+  80, 90, 80, 180, 80, 90, 80, 180, 80, 90, 80, 180,
+  60, 70, 60, 160, 60, 70, 60, 160, 60, 70, 60, 160,
+  60, 70, 60, 160, 68, 78, 68, 168, 68, 78, 68, 168,
+  68, 78, 68, 168, 68, 78, 68, 168, 60, 70, 60, 160,
+  60, 70, 60, 160, 60, 70, 60, 160, 60, 70, 60, 160,
+  140, 150, 140, 240, 140, 150, 140, 240, 140, 150, 140, 240,
+  140, 150, 140, 240, 40, 50, 40, 140, 40, 50, 40, 140,
+  40, 50, 40, 140, 40, 50, 40, 140, 48, 58, 48, 148,
+  48, 58, 48, 148, 48, 58, 48, 148, 48, 58, 48, 148,
+  40, 50, 40, 140, 40, 50, 40, 140, 40, 50, 40, 140,
+  40, 50, 40, 140, 120, 130, 120, 220, 120, 130, 120, 220,
+  120, 130, 120, 220, 120, 130, 120, 220, 46, 56, 46, 146,
+  46, 56, 46, 146, 46, 56, 46, 146, 46, 56, 46, 146,
+  54, 64, 54, 154, 54, 64, 54, 154, 54, 64, 54, 154,
+  54, 64, 54, 154, 46, 56, 46, 146, 46, 56, 46, 146,
+  46, 56, 46, 146, 46, 56, 46, 146, 126, 136, 126, 226,
+  126, 136, 126, 226, 126, 136, 126, 226, 126, 136, 126, 226,
+  40, 50, 40, 140, 40, 50, 40, 140, 40, 50, 40, 140,
+  40, 50, 40, 140, 48, 58, 48, 148, 48, 58, 48, 148,
+  48, 58, 48, 148, 48, 58, 48, 148, 40, 50, 40, 140,
+  40, 50, 40, 140, 40, 50, 40, 140, 40, 50, 40, 140,
+  120, 130, 120, 220, 120, 130, 120, 220, 120, 130, 120, 220,
+  120, 130, 120, 220, 100, 110, 100, 200, 100, 110, 100, 200,
+  100, 110, 100, 200, 100, 110, 100, 200, 108, 118, 108, 208,
+  108, 118, 108, 208, 108, 118, 108, 208, 108, 118, 108, 208,
+  100, 110, 100, 200, 100, 110, 100, 200, 100, 110, 100, 200,
+  100, 110, 100, 200, 180, 190, 180, 280, 180, 190, 180, 280,
+  180, 190, 180, 280, 180, 190, 180, 280, 0, 10, 0, 100,
+  0, 10, 0, 100, 0, 10, 0, 100, 0, 10, 0, 100,
+  8, 18, 8, 108, 8, 18, 8, 108, 8, 18, 8, 108,
+  8, 18, 8, 108, 0, 10, 0, 100, 0, 10, 0, 100,
+  0, 10, 0, 100, 0, 10, 0, 100, 80, 90, 80, 180,
+  80, 90, 80, 180, 80, 90, 80, 180, 80, 90, 80, 180,
+  6, 16, 6, 106, 6, 16, 6, 106, 6, 16, 6, 106,
+  6, 16, 6, 106, 14, 24, 14, 114, 14, 24, 14, 114,
+  14, 24, 14, 114, 14, 24, 14, 114, 6, 16, 6, 106,
+  6, 16, 6, 106, 6, 16, 6, 106, 6, 16, 6, 106,
+  86, 96, 86, 186, 86, 96, 86, 186, 86, 96, 86, 186,
+  86, 96, 86, 186, 0, 10, 0, 100, 0, 10, 0, 100,
+  0, 10, 0, 100, 0, 10, 0, 100, 8, 18, 8, 108,
+  8, 18, 8, 108, 8, 18, 8, 108, 8, 18, 8, 108,
+  0, 10, 0, 100, 0, 10, 0, 100, 0, 10, 0, 100,
+  0, 10, 0, 100, 80, 90, 80, 180, 80, 90, 80, 180,
+  80, 90, 80, 180, 80, 90, 80, 180, 60, 70, 60, 160,
+  60, 70, 60, 160, 60, 70, 60, 160, 60, 70, 60, 160,
+  68, 78, 68, 168, 68, 78, 68, 168, 68, 78, 68, 168,
+  68, 78, 68, 168, 60, 70, 60, 160, 60, 70, 60, 160,
+  60, 70, 60, 160, 60, 70, 60, 160, 140, 150, 140, 240,
+  140, 150, 140, 240, 140, 150, 140, 240, 140, 150, 140, 240,
+  4, 14, 4, 104, 4, 14, 4, 104, 4, 14, 4, 104,
+  4, 14, 4, 104, 12, 22, 12, 112, 12, 22, 12, 112,
+  12, 22, 12, 112, 12, 22, 12, 112, 4, 14, 4, 104,
+  4, 14, 4, 104, 4, 14, 4, 104, 4, 14, 4, 104,
+  84, 94, 84, 184, 84, 94, 84, 184, 84, 94, 84, 184,
+  84, 94, 84, 184, 10, 20, 10, 110, 10, 20, 10, 110,
+  10, 20, 10, 110, 10, 20, 10, 110, 18, 28, 18, 118,
+  18, 28, 18, 118, 18, 28, 18, 118, 18, 28, 18, 118,
+  10, 20, 10, 110, 10, 20, 10, 110, 10, 20, 10, 110,
+  10, 20, 10, 110, 90, 100, 90, 190, 90, 100, 90, 190,
+  90, 100, 90, 190, 90, 100, 90, 190, 4, 14, 4, 104,
+  4, 14, 4, 104, 4, 14, 4, 104, 4, 14, 4, 104,
+  12, 22, 12, 112, 12, 22, 12, 112, 12, 22, 12, 112,
+  12, 22, 12, 112, 4, 14, 4, 104, 4, 14, 4, 104,
+  4, 14, 4, 104, 4, 14, 4, 104, 84, 94, 84, 184,
+  84, 94, 84, 184, 84, 94, 84, 184, 84, 94, 84, 184,
+  64, 74, 64, 164, 64, 74, 64, 164, 64, 74, 64, 164,
+  64, 74, 64, 164, 72, 82, 72, 172, 72, 82, 72, 172,
+  72, 82, 72, 172, 72, 82, 72, 172, 64, 74, 64, 164,
+  64, 74, 64, 164, 64, 74, 64, 164, 64, 74, 64, 164,
+  144, 154, 144, 244, 144, 154, 144, 244, 144, 154, 144, 244,
+  144, 154, 144, 244, 0, 10, 0, 100, 0, 10, 0, 100,
+  0, 10, 0, 100, 0, 10, 0, 100, 8, 18, 8, 108,
+  8, 18, 8, 108, 8, 18, 8, 108, 8, 18, 8, 108,
+  0, 10, 0, 100, 0, 10, 0, 100, 0, 10, 0, 100,
+  0, 10, 0, 100, 80, 90, 80, 180, 80, 90, 80, 180,
+  80, 90, 80, 180, 80, 90, 80, 180, 6, 16, 6, 106,
+  6, 16, 6, 106, 6, 16, 6, 106, 6, 16, 6, 106,
+  14, 24, 14, 114, 14, 24, 14, 114, 14, 24, 14, 114,
+  14, 24, 14, 114, 6, 16, 6, 106, 6, 16, 6, 106,
+  6, 16, 6, 106, 6, 16, 6, 106, 86, 96, 86, 186,
+  86, 96, 86, 186, 86, 96, 86, 186, 86, 96, 86, 186,
+  0, 10, 0, 100, 0, 10, 0, 100, 0, 10, 0, 100,
+  0, 10, 0, 100, 8, 18, 8, 108, 8, 18, 8, 108,
+  8, 18, 8, 108, 8, 18, 8, 108, 0, 10, 0, 100,
+  0, 10, 0, 100, 0, 10, 0, 100, 0, 10, 0, 100,
+  80, 90, 80, 180, 80, 90, 80, 180, 80, 90, 80, 180,
+  80, 90, 80, 180, 60, 70, 60, 160, 60, 70, 60, 160,
+  60, 70, 60, 160, 60, 70, 60, 160, 68, 78, 68, 168,
+  68, 78, 68, 168, 68, 78, 68, 168, 68, 78, 68, 168,
+  60, 70, 60, 160, 60, 70, 60, 160, 60, 70, 60, 160,
+  60, 70, 60, 160, 140, 150, 140, 240, 140, 150, 140, 240,
+  140, 150, 140, 240, 140, 150, 140, 240, 40, 50, 40, 140,
+  40, 50, 40, 140, 40, 50, 40, 140, 40, 50, 40, 140,
+  48, 58, 48, 148, 48, 58, 48, 148, 48, 58, 48, 148,
+  48, 58, 48, 148, 40, 50, 40, 140, 40, 50, 40, 140,
+  40, 50, 40, 140, 40, 50, 40, 140, 120, 130, 120, 220,
+  120, 130, 120, 220, 120, 130, 120, 220, 120, 130, 120, 220,
+  46, 56, 46, 146, 46, 56, 46, 146, 46, 56, 46, 146,
+  46, 56, 46, 146, 54, 64, 54, 154, 54, 64, 54, 154,
+  54, 64, 54, 154, 54, 64, 54, 154, 46, 56, 46, 146,
+  46, 56, 46, 146, 46, 56, 46, 146, 46, 56, 46, 146,
+  126, 136, 126, 226, 126, 136, 126, 226, 126, 136, 126, 226,
+  126, 136, 126, 226, 40, 50, 40, 140, 40, 50, 40, 140,
+  40, 50, 40, 140, 40, 50, 40, 140, 48, 58, 48, 148,
+  48, 58, 48, 148, 48, 58, 48, 148, 48, 58, 48, 148,
+  40, 50, 40, 140, 40, 50, 40, 140, 40, 50, 40, 140,
+  40, 50, 40, 140, 120, 130, 120, 220, 120, 130, 120, 220,
+  120, 130, 120, 220, 120, 130, 120, 220, 100, 110, 100, 200,
+  100, 110, 100, 200, 100, 110, 100, 200, 100, 110, 100, 200,
+  108, 118, 108, 208, 108, 118, 108, 208, 108, 118, 108, 208,
+  108, 118, 108, 208, 100, 110, 100, 200, 100, 110, 100, 200,
+  100, 110, 100, 200, 100, 110, 100, 200, 180, 190, 180, 280,
+  180, 190, 180, 280, 180, 190, 180, 280, 180, 190, 180, 280,
+  0, 10, 0, 100, 0, 10, 0, 100, 0, 10, 0, 100,
+  0, 10, 0, 100, 8, 18, 8, 108, 8, 18, 8, 108,
+  8, 18, 8, 108, 8, 18, 8, 108, 0, 10, 0, 100,
+  0, 10, 0, 100, 0, 10, 0, 100, 0, 10, 0, 100,
+  80, 90, 80, 180, 80, 90, 80, 180, 80, 90, 80, 180,
+  80, 90, 80, 180, 6, 16, 6, 106, 6, 16, 6, 106,
+  6, 16, 6, 106, 6, 16, 6, 106, 14, 24, 14, 114,
+  14, 24, 14, 114, 14, 24, 14, 114, 14, 24, 14, 114,
+  6, 16, 6, 106, 6, 16, 6, 106, 6, 16, 6, 106,
+  6, 16, 6, 106, 86, 96, 86, 186, 86, 96, 86, 186,
+  86, 96, 86, 186, 86, 96, 86, 186, 0, 10, 0, 100,
+  0, 10, 0, 100, 0, 10, 0, 100, 0, 10, 0, 100,
+  8, 18, 8, 108, 8, 18, 8, 108, 8, 18, 8, 108,
+  8, 18, 8, 108, 0, 10, 0, 100, 0, 10, 0, 100,
+  0, 10, 0, 100, 0, 10, 0, 100, 80, 90, 80, 180,
+  80, 90, 80, 180, 80, 90, 80, 180, 80, 90, 80, 180,
+  60, 70, 60, 160, 60, 70, 60, 160, 60, 70, 60, 160,
+  60, 70, 60, 160, 68, 78, 68, 168, 68, 78, 68, 168,
+  68, 78, 68, 168, 68, 78, 68, 168, 60, 70, 60, 160,
+  60, 70, 60, 160, 60, 70, 60, 160, 60, 70, 60, 160,
+  140, 150, 140, 240, 140, 150, 140, 240, 140, 150, 140, 240,
+  140, 150, 140, 240, 4, 14, 4, 104, 4, 14, 4, 104,
+  4, 14, 4, 104, 4, 14, 4, 104, 12, 22, 12, 112,
+  12, 22, 12, 112, 12, 22, 12, 112, 12, 22, 12, 112,
+  4, 14, 4, 104, 4, 14, 4, 104, 4, 14, 4, 104,
+  4, 14, 4, 104, 84, 94, 84, 184, 84, 94, 84, 184,
+  84, 94, 84, 184, 84, 94, 84, 184, 10, 20, 10, 110,
+  10, 20, 10, 110, 10, 20, 10, 110, 10, 20, 10, 110,
+  18, 28, 18, 118, 18, 28, 18, 118, 18, 28, 18, 118,
+  18, 28, 18, 118, 10, 20, 10, 110, 10, 20, 10, 110,
+  10, 20, 10, 110, 10, 20, 10, 110, 90, 100, 90, 190,
+  90, 100, 90, 190, 90, 100, 90, 190, 90, 100, 90, 190,
+  4, 14, 4, 104, 4, 14, 4, 104, 4, 14, 4, 104,
+  4, 14, 4, 104, 12, 22, 12, 112, 12, 22, 12, 112,
+  12, 22, 12, 112, 12, 22, 12, 112, 4, 14, 4, 104,
+  4, 14, 4, 104, 4, 14, 4, 104, 4, 14, 4, 104,
+  84, 94, 84, 184, 84, 94, 84, 184, 84, 94, 84, 184,
+  84, 94, 84, 184, 64, 74, 64, 164, 64, 74, 64, 164,
+  64, 74, 64, 164, 64, 74, 64, 164, 72, 82, 72, 172,
+  72, 82, 72, 172, 72, 82, 72, 172, 72, 82, 72, 172,
+  64, 74, 64, 164, 64, 74, 64, 164, 64, 74, 64, 164,
+  64, 74, 64, 164, 144, 154, 144, 244, 144, 154, 144, 244,
+  144, 154, 144, 244, 144, 154, 144, 244, 0, 10, 0, 100,
+  0, 10, 0, 100, 0, 10, 0, 100, 0, 10, 0, 100,
+  8, 18, 8, 108, 8, 18, 8, 108, 8, 18, 8, 108,
+  8, 18, 8, 108, 0, 10, 0, 100, 0, 10, 0, 100,
+  0, 10, 0, 100, 0, 10, 0, 100, 80, 90, 80, 180,
+  80, 90, 80, 180, 80, 90, 80, 180, 80, 90, 80, 180,
+  6, 16, 6, 106, 6, 16, 6, 106, 6, 16, 6, 106,
+  6, 16, 6, 106, 14, 24, 14, 114, 14, 24, 14, 114,
+  14, 24, 14, 114, 14, 24, 14, 114, 6, 16, 6, 106,
+  6, 16, 6, 106, 6, 16, 6, 106, 6, 16, 6, 106,
+  86, 96, 86, 186, 86, 96, 86, 186, 86, 96, 86, 186,
+  86, 96, 86, 186, 0, 10, 0, 100, 0, 10, 0, 100,
+  0, 10, 0, 100, 0, 10, 0, 100, 8, 18, 8, 108,
+  8, 18, 8, 108, 8, 18, 8, 108, 8, 18, 8, 108,
+  0, 10, 0, 100, 0, 10, 0, 100, 0, 10, 0, 100,
+  0, 10, 0, 100, 80, 90, 80, 180, 80, 90, 80, 180,
+  80, 90, 80, 180, 80, 90, 80, 180, 60, 70, 60, 160,
+  60, 70, 60, 160, 60, 70, 60, 160, 60, 70, 60, 160,
+  68, 78, 68, 168, 68, 78, 68, 168, 68, 78, 68, 168,
+  68, 78, 68, 168, 60, 70, 60, 160, 60, 70, 60, 160,
+  60, 70, 60, 160, 60, 70, 60, 160, 140, 150, 140, 240,
+  140, 150, 140, 240, 140, 150, 140, 240, 140, 150, 140, 240,
+  40, 50, 40, 140, 40, 50, 40, 140, 40, 50, 40, 140,
+  40, 50, 40, 140, 48, 58, 48, 148, 48, 58, 48, 148,
+  48, 58, 48, 148, 48, 58, 48, 148, 40, 50, 40, 140,
+  40, 50, 40, 140, 40, 50, 40, 140, 40, 50, 40, 140,
+  120, 130, 120, 220, 120, 130, 120, 220, 120, 130, 120, 220,
+  120, 130, 120, 220, 46, 56, 46, 146, 46, 56, 46, 146,
+  46, 56, 46, 146, 46, 56, 46, 146, 54, 64, 54, 154,
+  54, 64, 54, 154, 54, 64, 54, 154, 54, 64, 54, 154,
+  46, 56, 46, 146, 46, 56, 46, 146, 46, 56, 46, 146,
+  46, 56, 46, 146, 126, 136, 126, 226, 126, 136, 126, 226,
+  126, 136, 126, 226, 126, 136, 126, 226, 40, 50, 40, 140,
+  40, 50, 40, 140, 40, 50, 40, 140, 40, 50, 40, 140,
+  48, 58, 48, 148, 48, 58, 48, 148, 48, 58, 48, 148,
+  48, 58, 48, 148, 40, 50, 40, 140, 40, 50, 40, 140,
+  40, 50, 40, 140, 40, 50, 40, 140, 120, 130, 120, 220,
+  120, 130, 120, 220, 120, 130, 120, 220, 120, 130, 120, 220,
+  100, 110, 100, 200, 100, 110, 100, 200, 100, 110, 100, 200,
+  100, 110, 100, 200, 108, 118, 108, 208, 108, 118, 108, 208,
+  108, 118, 108, 208, 108, 118, 108, 208, 100, 110, 100, 200,
+  100, 110, 100, 200, 100, 110, 100, 200, 100, 110, 100, 200,
+  180, 190, 180, 280, 180, 190, 180, 280, 180, 190, 180, 280,
+  180, 190, 180, 280,
+};
@@ -9,47 +9,526 @@
  */
 
 #include <assert.h>
+#include <fcntl.h>
 #include <glib.h>
+#include <malloc.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
 
 #define PROJECT_NAME "pinochle"
 
 /* *** helpers *** */
-GRand* grand = NULL;
 guint32
-get_rand_int()
+bit_count(guint64 bits)
 {
-    if (grand == NULL) {
-        grand = g_rand_new_with_seed(1);
+    return (guint32)__builtin_popcountll(bits);
+}
+
+/* index of the lowest set bit; bits must not be 0. */
+guint32
+bit_first(guint64 bits)
+{
+    return (guint32)__builtin_ctzll(bits);
+}
+/* ***** */
+
+/* *** stats *** */
+/* counters and timers for the hot paths, built in only when PINOCHLE_STATS
+ * is 1 (`xmake f --stats=y`). otherwise the STAT_ macros expand to nothing
+ * and cost nothing. each thread counts into a block of its own, so
+ * counting takes no lock, and stats_dump() adds them up. when a thread
+ * ends its block is added into the retired total and freed. timers count ticks (cycles from
+ * the time stamp counter on x86, nanoseconds elsewhere) into power-of-two
+ * buckets, from which the dump estimates the median and 99th percentile
+ * (each rounded up to a power of two). */
+#ifndef PINOCHLE_STATS
+#define PINOCHLE_STATS 0
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+enum stat_counter
+{
+    stat_deals,
+    stat_tricks,
+    stat_bids,
+    stat_meld_evals,
+    stat_allocs,
+    stat_rng_draws,
+    STAT_NCOUNTERS
+};
+
+enum stat_timer
+{
+    timer_deal,
+    timer_meld,
+    timer_bid,
+    timer_trick,
+    STAT_NTIMERS
+};
+
+const gchar* const STAT_COUNTER_NAMES[] = { "deals",      "tricks",
+                                            "bids",       "meld_evals",
+                                            "allocs",     "rng_draws" };
+const gchar* const STAT_TIMER_NAMES[] = { "deal", "meld", "bid", "trick" };
+
+#define STAT_BUCKETS 64
+
+struct stat_timer_data
+{
+    guint64 count;
+    guint64 total;
+    guint64 max;
+    guint64 buckets[STAT_BUCKETS]; /* bucket b counts times below 2^b */
+};
+
+struct stats
+{
+    guint64 counters[STAT_NCOUNTERS];
+    struct stat_timer_data timers[STAT_NTIMERS];
+    struct stats* next;
+};
+
+/* every live thread's block, and the sum of the blocks of threads that
+ * ended, for stats_dump(). */
+struct stats* stats_blocks = NULL;
+struct stats stats_retired;
+GMutex stats_lock;
+
+guint64
+stats_ticks()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return (guint64)g_get_monotonic_time() * 1000;
+#endif
+}
+
+/* adds the counts of from into into. */
+void
+stats_add(struct stats* into, const struct stats* from)
+{
+    for (guint32 i = 0; i < STAT_NCOUNTERS; i++) {
+        into->counters[i] += from->counters[i];
+    }
+    for (guint32 i = 0; i < STAT_NTIMERS; i++) {
+        const struct stat_timer_data* f = &from->timers[i];
+        struct stat_timer_data* t = &into->timers[i];
+        t->count += f->count;
+        t->total += f->total;
+        t->max = f->max > t->max ? f->max : t->max;
+        for (guint32 b = 0; b < STAT_BUCKETS; b++) {
+            t->buckets[b] += f->buckets[b];
+        }
+    }
+}
+
+/* unlinks the block of a thread that ended, adds it into the retired
+ * total and frees it. */
+void
+stats_retire(gpointer data)
+{
+    struct stats* local = data;
+    g_mutex_lock(&stats_lock);
+    struct stats** link = &stats_blocks;
+    while (*link != local) {
+        link = &(*link)->next;
     }
+    *link = local->next;
+    stats_add(&stats_retired, local);
+    g_mutex_unlock(&stats_lock);
+    free(local);
+}
+
+GPrivate stats_private = G_PRIVATE_INIT(stats_retire);
 
-    guint32 num = g_rand_int(grand);
+/* the calling thread's block. */
+struct stats*
+stats_local()
+{
+    static __thread struct stats* local = NULL;
+    if (local == NULL) {
+        local = calloc(1, sizeof(struct stats));
+        g_mutex_lock(&stats_lock);
+        local->next = stats_blocks;
+        stats_blocks = local;
+        g_mutex_unlock(&stats_lock);
+        g_private_set(&stats_private, local);
+    }
 
-    return num;
+    return local;
 }
 
-GRand* grand_range = NULL;
-gint32
-get_rand_int_range(gint32 begin, gint32 end)
+void
+stats_record(enum stat_timer timer, guint64 ticks)
+{
+    struct stat_timer_data* t = &stats_local()->timers[timer];
+    t->count++;
+    t->total += ticks;
+    t->max = ticks > t->max ? ticks : t->max;
+    t->buckets[ticks == 0 ? 0 : 64 - __builtin_clzll(ticks) - 1]++;
+}
+
+#if PINOCHLE_STATS
+#define STAT_INC(c) (stats_local()->counters[(c)]++)
+#define STAT_TIMER_BEGIN(t) guint64 stat_begin_##t = stats_ticks()
+#define STAT_TIMER_END(t) stats_record((t), stats_ticks() - stat_begin_##t)
+#else
+#define STAT_INC(c) ((void)0)
+#define STAT_TIMER_BEGIN(t) ((void)0)
+#define STAT_TIMER_END(t) ((void)0)
+#endif
+
+/* adds up every thread's block into out. */
+void
+stats_sum(struct stats* out)
+{
+    g_mutex_lock(&stats_lock);
+    *out = stats_retired;
+    for (struct stats* s = stats_blocks; s != NULL; s = s->next) {
+        stats_add(out, s);
+    }
+    g_mutex_unlock(&stats_lock);
+    out->next = NULL;
+}
+
+/* the bound of the bucket holding the q-th quantile of t. */
+guint64
+stats_quantile(struct stat_timer_data* t, double q)
+{
+    guint64 rank = (guint64)(q * (double)t->count);
+    guint64 seen = 0;
+    for (guint32 b = 0; b < STAT_BUCKETS; b++) {
+        seen += t->buckets[b];
+        if (seen > rank) {
+            return b + 1 < STAT_BUCKETS ? 1ULL << (b + 1) : G_MAXUINT64;
+        }
+    }
+
+    return t->max;
+}
+
+/* prints every counter and timer as csv. */
+void
+stats_dump(FILE* out)
+{
+    struct stats s;
+    stats_sum(&s);
+    fprintf(out, "counter,value\n");
+    for (guint32 i = 0; i < STAT_NCOUNTERS; i++) {
+        fprintf(out,
+                "%s,%" G_GUINT64_FORMAT "\n",
+                STAT_COUNTER_NAMES[i],
+                s.counters[i]);
+    }
+    fprintf(out, "timer,count,mean_ticks,p50_ticks,p99_ticks,max_ticks\n");
+    for (guint32 i = 0; i < STAT_NTIMERS; i++) {
+        struct stat_timer_data* t = &s.timers[i];
+        fprintf(out,
+                "%s,%" G_GUINT64_FORMAT ",%.1f,%" G_GUINT64_FORMAT
+                ",%" G_GUINT64_FORMAT ",%" G_GUINT64_FORMAT "\n",
+                STAT_TIMER_NAMES[i],
+                t->count,
+                t->count > 0 ? (double)t->total / (double)t->count : 0.0,
+                stats_quantile(t, 0.5),
+                stats_quantile(t, 0.99),
+                t->max);
+    }
+}
+
+void
+stats_dump_at_exit()
+{
+    stats_dump(stderr);
+}
+
+/* dumps the stats to stderr when the process exits, if they are built in
+ * and PINOCHLE_STATS is set in the environment. */
+void
+stats_init()
 {
-    if (grand_range == NULL) {
-        grand_range = g_rand_new_with_seed(1);
+    if (PINOCHLE_STATS && g_getenv("PINOCHLE_STATS") != NULL) {
+        atexit(stats_dump_at_exit);
     }
+}
 
-    gint32 num = g_rand_int_range(grand_range, begin, end);
+/* the number of live blocks. */
+guint32
+stats_nblocks()
+{
+    guint32 n = 0;
+    g_mutex_lock(&stats_lock);
+    for (struct stats* s = stats_blocks; s != NULL; s = s->next) {
+        n++;
+    }
+    g_mutex_unlock(&stats_lock);
 
-    return num;
+    return n;
 }
 
 gpointer
-get_rand_list_elem(GList* lst)
+stats_test_thread(gpointer data)
+{
+    stats_local()->counters[stat_deals] += 3;
+
+    return NULL;
+}
+
+void
+stats_tests()
+{
+    printf("[+] Running tests for stats.\n");
+
+    /* test counters are only counted when built in */
+    struct stats s11;
+    stats_sum(&s11);
+    STAT_INC(stat_deals);
+    STAT_INC(stat_deals);
+    struct stats s12;
+    stats_sum(&s12);
+    assert(s12.counters[stat_deals] - s11.counters[stat_deals] ==
+           (PINOCHLE_STATS ? 2 : 0));
+
+    /* test record() buckets and quantiles */
+    struct stat_timer_data* t21 = &stats_local()->timers[timer_trick];
+    struct stat_timer_data before21 = *t21;
+    for (guint64 i = 0; i < 99; i++) {
+        stats_record(timer_trick, 100);
+    }
+    stats_record(timer_trick, 100000);
+    assert(t21->count - before21.count == 100);
+    struct stat_timer_data d21 = { 0 };
+    d21.count = 100;
+    d21.buckets[6] = 99; /* 100 is in [64, 128) */
+    d21.buckets[16] = 1;
+    d21.max = 100000;
+    assert(stats_quantile(&d21, 0.5) == 128);
+    assert(stats_quantile(&d21, 0.99) == 1ULL << 17);
+
+    /* test a timer around some work */
+    STAT_TIMER_BEGIN(timer_meld);
+    guint64 x31 = 0;
+    for (guint64 i = 0; i < 1000; i++) {
+        x31 += i * i;
+    }
+    assert(x31 > 0);
+    STAT_TIMER_END(timer_meld);
+
+    /* test dump() writes a row per counter and timer under two headers */
+    FILE* f41 = tmpfile();
+    stats_dump(f41);
+    rewind(f41);
+    gchar line41[256];
+    gchar trick41[64];
+    g_snprintf(trick41,
+               sizeof(trick41),
+               "%s,%" G_GUINT64_FORMAT ",",
+               STAT_TIMER_NAMES[timer_trick],
+               t21->count);
+    guint32 nlines41 = 0;
+    guint32 ntrick41 = 0;
+    while (fgets(line41, sizeof(line41), f41) != NULL) {
+        if (nlines41 == 0) {
+            assert(g_strcmp0(line41, "counter,value\n") == 0);
+        }
+        if (nlines41 == STAT_NCOUNTERS + 1) {
+            assert(g_str_has_prefix(line41, "timer,count,"));
+        }
+        ntrick41 += g_str_has_prefix(line41, trick41);
+        nlines41++;
+    }
+    assert(nlines41 == 2 + STAT_NCOUNTERS + STAT_NTIMERS);
+    assert(ntrick41 == 1);
+    fclose(f41);
+
+    /* test the block of a thread that ended is kept in the sum and freed */
+    struct stats s51;
+    stats_sum(&s51);
+    guint32 nblocks51 = stats_nblocks();
+    for (guint32 i = 0; i < 4; i++) {
+        g_thread_join(g_thread_new("stats", stats_test_thread, NULL));
+    }
+    struct stats s52;
+    stats_sum(&s52);
+    assert(s52.counters[stat_deals] - s51.counters[stat_deals] == 12);
+    assert(stats_nblocks() == nblocks51);
+
+    printf("[+] Finished tests for stats.\n");
+}
+/* ***** */
+
+/* *** rng *** */
+/* xoshiro256** (blackman & vigna). the whole state is four words, so a
+ * stream can be copied, stored in a game and handed to a thread without
+ * any locking. streams for parallel workers are made with rng_split(),
+ * which jumps the parent 2^128 draws ahead, so split streams never
+ * overlap. */
+struct rng
+{
+    guint64 s[4];
+};
+
+guint64
+rng_rotl(guint64 x, int k)
+{
+    return (x << k) | (x >> (64 - k));
+}
+
+/* the state is filled from splitmix64 so that any seed, including 0,
+ * gives a well-mixed state. */
+void
+rng_seed(struct rng* r, guint64 seed)
+{
+    for (unsigned long i = 0; i < 4; i++) {
+        seed += 0x9e3779b97f4a7c15ULL;
+        guint64 z = seed;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        r->s[i] = z ^ (z >> 31);
+    }
+}
+
+guint64
+rng_next(struct rng* r)
 {
-    guint32 len = g_list_length(lst);
-    gint32 rand_pos = get_rand_int_range(0, (gint32)len);
-    gpointer data = g_list_nth_data(lst, (guint)rand_pos);
+    STAT_INC(stat_rng_draws);
+    guint64* s = r->s;
+    guint64 result = rng_rotl(s[1] * 5, 7) * 9;
+    guint64 t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rng_rotl(s[3], 45);
+
+    return result;
+}
+
+guint32
+rng_int(struct rng* r)
+{
+    return (guint32)(rng_next(r) >> 32);
+}
+
+/* a uniformly distributed integer in [begin, end), like
+ * g_rand_int_range(). uses lemire's multiply-and-reject, so there is no
+ * modulo bias and usually no division. */
+gint32
+rng_int_range(struct rng* r, gint32 begin, gint32 end)
+{
+    guint32 n = (guint32)(end - begin);
+    guint64 m = (guint64)rng_int(r) * n;
+    guint32 low = (guint32)m;
+    if (low < n) {
+        guint32 threshold = -n % n;
+        while (low < threshold) {
+            m = (guint64)rng_int(r) * n;
+            low = (guint32)m;
+        }
+    }
+
+    return begin + (gint32)(m >> 32);
+}
+
+/* advances the stream by 2^128 draws. */
+void
+rng_jump(struct rng* r)
+{
+    static const guint64 JUMP[] = { 0x180ec6d33cfd0abaULL,
+                                    0xd5a61266f0c9392cULL,
+                                    0xa9582618e03fc9aaULL,
+                                    0x39abdc4529b1661cULL };
+    guint64 s[4] = { 0, 0, 0, 0 };
+    for (unsigned long i = 0; i < 4; i++) {
+        for (int b = 0; b < 64; b++) {
+            if (JUMP[i] & (1ULL << b)) {
+                s[0] ^= r->s[0];
+                s[1] ^= r->s[1];
+                s[2] ^= r->s[2];
+                s[3] ^= r->s[3];
+            }
+            rng_next(r);
+        }
+    }
+    for (unsigned long i = 0; i < 4; i++) {
+        r->s[i] = s[i];
+    }
+}
+
+/* copies the current stream into child and moves the parent past
+ * everything the child can draw. call it once per worker. */
+void
+rng_split(struct rng* parent, struct rng* child)
+{
+    *child = *parent;
+    rng_jump(parent);
+}
+
+void
+rng_tests()
+{
+    printf("[+] Running tests for rng.\n");
+
+    /* test seed() is reproducible */
+    struct rng r11;
+    struct rng r12;
+    rng_seed(&r11, 42);
+    rng_seed(&r12, 42);
+    for (int i = 0; i < 100; i++) {
+        assert(rng_next(&r11) == rng_next(&r12));
+    }
 
-    return data;
+    /* test different seeds give different streams */
+    struct rng r21;
+    struct rng r22;
+    rng_seed(&r21, 1);
+    rng_seed(&r22, 2);
+    assert(rng_next(&r21) != rng_next(&r22));
+
+    /* test state is copyable */
+    struct rng r31;
+    rng_seed(&r31, 7);
+    rng_next(&r31);
+    struct rng r32 = r31;
+    assert(rng_next(&r31) == rng_next(&r32));
+
+    /* test int_range() stays in range and hits every value */
+    struct rng r41;
+    rng_seed(&r41, 3);
+    guint32 seen41[6] = { 0 };
+    for (int i = 0; i < 6000; i++) {
+        gint32 v = rng_int_range(&r41, 10, 16);
+        assert(v >= 10 && v < 16);
+        seen41[v - 10]++;
+    }
+    for (int i = 0; i < 6; i++) {
+        assert(seen41[i] > 800 && seen41[i] < 1200);
+    }
+    assert(rng_int_range(&r41, 5, 6) == 5);
+
+    /* test split() gives the child the parent's old stream */
+    struct rng r51;
+    rng_seed(&r51, 9);
+    struct rng r52 = r51;
+    struct rng r53;
+    rng_split(&r51, &r53);
+    assert(rng_next(&r52) == rng_next(&r53));
+    assert(rng_next(&r51) != rng_next(&r52));
+
+    printf("[+] Finished tests for rng.\n");
 }
 /* ***** */
 
@@ -58,8 +537,8 @@ const unsigned int NUM_CARDS_DEALT_AT_ONCE = 3;
 /* sometimes it's 4. */
 // const unsigned int NUM_CARDS_DEALT_AT_ONCE = 4;
 
-/* disable bidding; TODO implement bidding system */
-const unsigned int WITH_BIDS = 0;
+/* when set, the winner of the auction names trump and leads. */
+const unsigned int WITH_BIDS = 1;
 
 /* TODO think about this -> should i use enums for ranks and suits? */
 const unsigned int NRANK = 6;
@@ -101,12 +580,176 @@ enum card_state
     in_pile
 };
 
+/* *** arena *** */
+/* a bump allocator. objects that live and die together (everything in a
+ * game) are carved out of large chunks and released all at once by
+ * arena_free(), instead of one malloc() and free() per object. the arena
+ * header lives in its first chunk, so a small arena is one allocation.
+ * objects are bumped from the head chunk. one that does not fit in what
+ * is left of it and is bigger than a quarter of a chunk gets a chunk of
+ * its own, linked behind the head, so the head keeps its room for the
+ * small objects that follow and a new head wastes at most a quarter.
+ * objects from an arena must not be passed to free() or to the *_free()
+ * function of their type.
+ *
+ * ownership: cards are values; drawing, removing or getting a card copies
+ * it into a struct card the caller owns, and no container keeps pointers
+ * to cards. an object from *_new() is owned by its caller and released by
+ * the matching *_free(), which also releases everything it points to (a
+ * player its name and hand). a game owns its players, hands and deck. */
+#define ARENA_ALIGN 16
+
+struct arena_chunk
+{
+    struct arena_chunk* next;
+    gsize size; /* bytes in data */
+    gsize used;
+    _Alignas(ARENA_ALIGN) guint8 data[];
+};
+
+struct arena
+{
+    struct arena_chunk* chunks;
+    gsize chunk_size;
+    gsize nchunks;
+};
+
+gsize
+arena_round(gsize size)
+{
+    return (size + ARENA_ALIGN - 1) & ~(gsize)(ARENA_ALIGN - 1);
+}
+
+struct arena_chunk*
+arena_chunk_new(gsize size)
+{
+    struct arena_chunk* c = malloc(sizeof(struct arena_chunk) + size);
+    c->next = NULL;
+    c->size = size;
+    c->used = 0;
+
+    return c;
+}
+
+/* an arena that grows chunk_size bytes at a time. */
+struct arena*
+arena_new(gsize chunk_size)
+{
+    chunk_size = arena_round(chunk_size + sizeof(struct arena));
+    struct arena_chunk* c = arena_chunk_new(chunk_size);
+    struct arena* a = (struct arena*)c->data;
+    c->used = arena_round(sizeof(struct arena));
+    a->chunks = c;
+    a->chunk_size = chunk_size;
+    a->nchunks = 1;
+
+    return a;
+}
+
+void*
+arena_alloc(struct arena* a, gsize size)
+{
+    STAT_INC(stat_allocs);
+    size = arena_round(size);
+    struct arena_chunk* c = a->chunks;
+    if (c->size - c->used < size && size > a->chunk_size / 4) {
+        c = arena_chunk_new(size);
+        c->next = a->chunks->next;
+        a->chunks->next = c;
+        a->nchunks++;
+    } else if (c->size - c->used < size) {
+        c = arena_chunk_new(a->chunk_size);
+        c->next = a->chunks;
+        a->chunks = c;
+        a->nchunks++;
+    }
+    void* ptr = c->data + c->used;
+    c->used += size;
+
+    return ptr;
+}
+
+gchar*
+arena_strdup(struct arena* a, const gchar* str)
+{
+    gsize len = strlen(str) + 1;
+    gchar* copy = arena_alloc(a, len);
+    memcpy(copy, str, len);
+
+    return copy;
+}
+
+/* releases every object in the arena and the arena itself. */
+void
+arena_free(struct arena* a)
+{
+    struct arena_chunk* c = a->chunks;
+    while (c != NULL) {
+        struct arena_chunk* next = c->next;
+        free(c);
+        c = next;
+    }
+}
+
+void
+arena_tests()
+{
+    printf("[+] Running tests for arena.\n");
+
+    /* test alloc() is aligned and fits in the first chunk */
+    struct arena* a11 = arena_new(256);
+    guint8* p11 = arena_alloc(a11, 3);
+    guint8* p12 = arena_alloc(a11, 40);
+    assert(((guintptr)p11 % ARENA_ALIGN) == 0);
+    assert(((guintptr)p12 % ARENA_ALIGN) == 0);
+    assert(p12 - p11 == ARENA_ALIGN);
+    assert(a11->nchunks == 1);
+    memset(p12, 0xff, 40);
+    arena_free(a11);
+
+    /* test alloc() grows by chunks, and takes objects bigger than one */
+    struct arena* a21 = arena_new(64);
+    for (int i = 0; i < 10; i++) {
+        arena_alloc(a21, 32);
+    }
+    assert(a21->nchunks > 1);
+    gsize n21 = a21->nchunks;
+    guint8* p21 = arena_alloc(a21, 1000);
+    memset(p21, 0, 1000);
+    assert(a21->nchunks == n21 + 1);
+    arena_free(a21);
+
+    /* test a big object does not take over the head chunk: small objects
+     * carry on where they left off */
+    struct arena* a22 = arena_new(256);
+    guint8* p22 = arena_alloc(a22, 16);
+    struct arena_chunk* head22 = a22->chunks;
+    guint8* p23 = arena_alloc(a22, 4096);
+    memset(p23, 0, 4096);
+    guint8* p24 = arena_alloc(a22, 16);
+    assert(a22->chunks == head22 && a22->nchunks == 2);
+    assert(p24 - p22 == 16);
+    assert(head22->next->size == 4096);
+    arena_free(a22);
+
+    /* test strdup() */
+    struct arena* a31 = arena_new(64);
+    gchar* s31 = arena_strdup(a31, "silvio dante");
+    assert(g_strcmp0(s31, "silvio dante") == 0);
+    arena_free(a31);
+
+    printf("[+] Finished tests for arena.\n");
+}
+/* ***** */
+
 /* *** card *** */
+/* one byte for each field. they hold an enum suit, enum rank and enum
+ * card_state. */
 struct card
 {
-    enum suit suit;
-    enum rank rank;
-    enum card_state state;
+    guint8 suit;
+    guint8 rank;
+    guint8 state;
 };
 
 struct card*
@@ -120,6 +763,17 @@ card_new(enum rank rank, enum suit suit)
     return c;
 }
 
+struct card*
+card_new_in(struct arena* a, enum rank rank, enum suit suit)
+{
+    struct card* c = arena_alloc(a, sizeof(struct card));
+    c->suit = suit;
+    c->rank = rank;
+    c->state = in_deck;
+
+    return c;
+}
+
 void
 card_free(struct card* c)
 {
@@ -129,20 +783,7 @@ card_free(struct card* c)
 unsigned int
 card_is_valid(struct card* c)
 {
-    enum rank rank = c->rank;
-    if (rank == ace || rank == ten || rank == king || rank == queen ||
-        rank == jack || rank == nine) {
-        enum suit suit = c->suit;
-        if (suit == clubs || suit == diamonds || suit == hearts ||
-            suit == spades) {
-            return 1;
-        } else {
-            return 0;
-        }
-
-    } else {
-        return 0;
-    }
+    return c->rank < NRANK && c->suit < NSUIT;
 }
 
 int
@@ -155,146 +796,316 @@ card_compare(struct card* c1, struct card* c2)
     }
 }
 
+/* bit r is set when rank r is a counter, or a noncounter. */
+#define CARD_COUNTER_RANKS ((1u << ace) | (1u << ten) | (1u << king))
+#define CARD_NONCOUNTER_RANKS ((1u << queen) | (1u << jack) | (1u << nine))
+
 unsigned int
 card_is_counter(struct card* card)
 {
-    enum rank rank = card->rank;
-    for (unsigned long i = 0; i < NCOUNTERS; i++) {
-        if (rank == COUNTERS[i]) {
-            return 1;
-        }
-    }
-    return 0;
+    return card->rank < NRANK && ((CARD_COUNTER_RANKS >> card->rank) & 1);
 }
 
 unsigned int
 card_is_noncounter(struct card* card)
 {
-    enum rank rank = card->rank;
-    for (unsigned long i = 0; i < NNONCOUNTERS; i++) {
-        if (rank == NONCOUNTERS[i]) {
-            return 1;
-        }
-    }
-    return 0;
+    return card->rank < NRANK && ((CARD_NONCOUNTER_RANKS >> card->rank) & 1);
 }
 
-GString*
-card_str(struct card* card)
-{
-    GString* buf = g_string_new("");
-    enum rank rank = card->rank;
-    if (rank == ace) {
-        g_string_append(buf, "ace");
-    } else if (rank == ten) {
-        g_string_append(buf, "ten");
-    } else if (rank == king) {
-        g_string_append(buf, "king");
-    } else if (rank == queen) {
-        g_string_append(buf, "queen");
-    } else if (rank == jack) {
-        g_string_append(buf, "jack");
-    } else if (rank == nine) {
-        g_string_append(buf, "nine");
-    } else {
-        g_string_append(buf, "unknown");
+/* a card id packs a card into one byte: the suit in bits 0-1, the rank in
+ * bits 2-4 and the copy (0 for a single deck) in bits 5-6. the low five
+ * bits are the card's face, rank * NSUIT + suit, which indexes the tables
+ * below and the name tables. */
+typedef guint8 card_id;
+
+#define CARD_ID_SUIT_MASK 0x3
+#define CARD_ID_RANK_SHIFT 2
+#define CARD_ID_FACE_MASK 0x1f
+#define CARD_ID_COPY_SHIFT 5
+#define CARD_ID_MAX_COPIES 4
+#define CARD_ID_NFACES 24
+
+/* bit f is set when the card with face f is a counter: the aces, tens and
+ * kings are faces 0 to 11. */
+#define CARD_ID_COUNTER_FACES 0x000fffu
+
+/* the points each face is worth when taken in a trick. */
+const guint8 CARD_ID_POINTS[CARD_ID_NFACES] = {
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
 
-        return buf;
-    }
+card_id
+card_id_make(enum rank rank, enum suit suit, guint32 copy)
+{
+    return (card_id)((copy << CARD_ID_COPY_SHIFT) |
+                     (rank << CARD_ID_RANK_SHIFT) | suit);
+}
 
-    g_string_append(buf, " of ");
+card_id
+card_id_of(struct card* c, guint32 copy)
+{
+    return card_id_make(c->rank, c->suit, copy);
+}
 
-    enum suit suit = card->suit;
-    if (suit == clubs) {
-        g_string_append(buf, "clubs");
-    } else if (suit == diamonds) {
-        g_string_append(buf, "diamonds");
-    } else if (suit == hearts) {
-        g_string_append(buf, "hearts");
-    } else if (suit == spades) {
-        g_string_append(buf, "spades");
-    }
+guint32
+card_id_face(card_id id)
+{
+    return id & CARD_ID_FACE_MASK;
+}
 
-    return buf;
+enum suit
+card_id_suit(card_id id)
+{
+    return (enum suit)(id & CARD_ID_SUIT_MASK);
 }
 
-void
-card_str_free(void* str)
+enum rank
+card_id_rank(card_id id)
 {
-    g_string_free(str, FALSE);
+    return (enum rank)(card_id_face(id) >> CARD_ID_RANK_SHIFT);
 }
 
-void
-card_show(struct card* card, const char* fmtstr)
+guint32
+card_id_copy(card_id id)
 {
-    GString* buf = card_str(card);
-    printf(fmtstr, buf->str);
-    g_string_free(buf, FALSE);
+    return id >> CARD_ID_COPY_SHIFT;
 }
 
 void
-card_show_gfunc(gpointer card, gpointer fmtstr)
+card_id_card(card_id id, struct card* out)
 {
-    card_show((struct card*)card, (const char*)fmtstr);
+    out->suit = card_id_suit(id);
+    out->rank = card_id_rank(id);
+    out->state = in_deck;
 }
 
-void
-card_tests()
+unsigned int
+card_id_is_valid(card_id id)
 {
-    printf("[+] Running tests for card.\n");
+    return card_id_face(id) < CARD_ID_NFACES &&
+           card_id_copy(id) < CARD_ID_MAX_COPIES;
+}
 
-    /* test creation */
-    struct card* c11 = card_new(ace, spades);
-    assert(c11->rank == ace);
-    assert(c11->suit == spades);
-    assert(c11->state == in_deck);
-    card_free(c11);
+/* the id must be valid. */
+unsigned int
+card_id_is_counter(card_id id)
+{
+    return (CARD_ID_COUNTER_FACES >> card_id_face(id)) & 1;
+}
 
-    /* test is_valid() */
-    struct card* c61 = card_new(ace, spades);
-    assert(card_is_valid(c61) == 1);
-    card_free(c61);
-    struct card* c62 = card_new(ace, spades);
-    c62->rank = 99;
-    assert(card_is_valid(c62) == 0);
-    card_free(c62);
-    struct card* c63 = card_new(ace, spades);
-    c63->suit = 99;
-    assert(card_is_valid(c63) == 0);
-    card_free(c63);
+/* the id must be valid. */
+guint32
+card_id_points(card_id id)
+{
+    return CARD_ID_POINTS[card_id_face(id)];
+}
 
-    /* test is_counter() */
-    struct card* c21 = card_new(ace, spades);
-    assert(card_is_counter(c21) == 1);
-    card_free(c21);
-    struct card* c22 = card_new(queen, spades);
-    assert(card_is_counter(c22) == 0);
-    card_free(c22);
+/* the points in n valid ids. one load and add per card, with no branches,
+ * so the compiler can vectorize it. */
+guint32
+card_ids_points(const card_id* ids, guint32 n)
+{
+    guint32 points = 0;
+    for (guint32 i = 0; i < n; i++) {
+        points += CARD_ID_POINTS[ids[i] & CARD_ID_FACE_MASK];
+    }
 
-    /* test is_noncounter() */
-    struct card* c31 = card_new(queen, spades);
-    assert(card_is_noncounter(c31) == 1);
-    card_free(c31);
-    struct card* c32 = card_new(ace, spades);
-    assert(card_is_noncounter(c32) == 0);
-    card_free(c32);
+    return points;
+}
+
+/* how many of n valid ids are counters. */
+guint32
+card_ids_count_counters(const card_id* ids, guint32 n)
+{
+    guint32 counters = 0;
+    for (guint32 i = 0; i < n; i++) {
+        counters += (CARD_ID_COUNTER_FACES >> (ids[i] & CARD_ID_FACE_MASK)) & 1;
+    }
+
+    return counters;
+}
+
+/* the name and short code of every card, indexed by card_index(). */
+const gchar* const CARD_NAMES[] = {
+    "ace of clubs", "ace of diamonds",
+    "ace of hearts", "ace of spades",
+    "ten of clubs", "ten of diamonds",
+    "ten of hearts", "ten of spades",
+    "king of clubs", "king of diamonds",
+    "king of hearts", "king of spades",
+    "queen of clubs", "queen of diamonds",
+    "queen of hearts", "queen of spades",
+    "jack of clubs", "jack of diamonds",
+    "jack of hearts", "jack of spades",
+    "nine of clubs", "nine of diamonds",
+    "nine of hearts", "nine of spades",
+};
+const gchar* const SUIT_NAMES[] = { "clubs", "diamonds", "hearts", "spades" };
+const gchar* const CARD_CODES[] = {
+    "AC", "AD", "AH", "AS",
+    "TC", "TD", "TH", "TS",
+    "KC", "KD", "KH", "KS",
+    "QC", "QD", "QH", "QS",
+    "JC", "JD", "JH", "JS",
+    "9C", "9D", "9H", "9S",
+};
+
+/* the card's place in the name tables, its card id face. the card must
+ * be valid. */
+guint32
+card_index(struct card* card)
+{
+    return card_id_face(card_id_of(card, 0));
+}
+
+/* the card's name, such as "ace of spades". the string is static and must
+ * not be freed. */
+const gchar*
+card_str(struct card* card)
+{
+    if (card_is_valid(card) == 0) {
+        return "unknown";
+    }
+
+    return CARD_NAMES[card_index(card)];
+}
+
+/* the card's short code, such as "AS" or "TH". the string is static. */
+const gchar*
+card_code(struct card* card)
+{
+    if (card_is_valid(card) == 0) {
+        return "??";
+    }
+
+    return CARD_CODES[card_index(card)];
+}
+
+/* reads a short code such as "AS" into out. returns 1 on success and 0 if
+ * code is not a card. */
+unsigned int
+card_parse_code(const gchar* code, struct card* out)
+{
+    for (guint32 f = 0; f < CARD_ID_NFACES; f++) {
+        if (g_ascii_strcasecmp(code, CARD_CODES[f]) == 0) {
+            card_id_card((card_id)f, out);
+
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+void
+card_show(struct card* card, const char* fmtstr)
+{
+    printf(fmtstr, card_str(card));
+}
+
+void
+card_tests()
+{
+    printf("[+] Running tests for card.\n");
+
+    /* test creation */
+    struct card* c11 = card_new(ace, spades);
+    assert(c11->rank == ace);
+    assert(c11->suit == spades);
+    assert(c11->state == in_deck);
+    card_free(c11);
+    struct arena* a12 = arena_new(64);
+    struct card* c12 = card_new_in(a12, queen, hearts);
+    assert(c12->rank == queen && c12->suit == hearts);
+    arena_free(a12);
+
+    /* test is_valid() */
+    struct card* c61 = card_new(ace, spades);
+    assert(card_is_valid(c61) == 1);
+    card_free(c61);
+    struct card* c62 = card_new(ace, spades);
+    c62->rank = 99;
+    assert(card_is_valid(c62) == 0);
+    card_free(c62);
+    struct card* c63 = card_new(ace, spades);
+    c63->suit = 99;
+    assert(card_is_valid(c63) == 0);
+    card_free(c63);
+
+    /* test is_counter() */
+    struct card* c21 = card_new(ace, spades);
+    assert(card_is_counter(c21) == 1);
+    card_free(c21);
+    struct card* c22 = card_new(queen, spades);
+    assert(card_is_counter(c22) == 0);
+    card_free(c22);
+
+    /* test is_noncounter() */
+    struct card* c31 = card_new(queen, spades);
+    assert(card_is_noncounter(c31) == 1);
+    card_free(c31);
+    struct card* c32 = card_new(ace, spades);
+    assert(card_is_noncounter(c32) == 0);
+    card_free(c32);
+
+    /* test id make() and its fields */
+    for (guint32 r = 0; r < NRANK; r++) {
+        for (guint32 s = 0; s < NSUIT; s++) {
+            for (guint32 k = 0; k < CARD_ID_MAX_COPIES; k++) {
+                card_id id = card_id_make(r, s, k);
+                assert(card_id_is_valid(id) == 1);
+                assert(card_id_rank(id) == r && card_id_suit(id) == s);
+                assert(card_id_copy(id) == k);
+                struct card c;
+                card_id_card(id, &c);
+                assert(card_id_of(&c, k) == id);
+                assert(card_id_is_counter(id) == card_is_counter(&c));
+                assert(card_id_points(id) == card_is_counter(&c));
+            }
+        }
+    }
+    assert(card_id_is_valid(card_id_make(nine, spades, 0) + 1) == 0);
+    assert(card_id_is_valid(card_id_make(ace, clubs, 0) | 0x80) == 0);
+
+    /* test ids_points() and ids_count_counters() over a hand */
+    card_id ids81[] = { card_id_make(ace, spades, 0),
+                        card_id_make(ace, spades, 1),
+                        card_id_make(queen, hearts, 0),
+                        card_id_make(king, clubs, 0),
+                        card_id_make(nine, diamonds, 1) };
+    assert(card_ids_points(ids81, 5) == 3);
+    assert(card_ids_count_counters(ids81, 5) == 3);
+    assert(card_ids_count_counters(ids81, 0) == 0);
 
     /* test str() */
     struct card* c41 = card_new(ace, spades);
-    GString* c41_str = card_str(c41);
-    assert(g_strcmp0(c41_str->str, "ace of spades") == 0);
-    g_string_free(c41_str, FALSE);
+    assert(g_strcmp0(card_str(c41), "ace of spades") == 0);
     card_free(c41);
     struct card* c42 = card_new(queen, hearts);
-    GString* c42_str = card_str(c42);
-    assert(g_strcmp0(c42_str->str, "queen of hearts") == 0);
-    g_string_free(c42_str, FALSE);
+    assert(g_strcmp0(card_str(c42), "queen of hearts") == 0);
+    /* the same card borrows the same string */
+    struct card c43 = { hearts, queen, in_play };
+    assert(card_str(c42) == card_str(&c43));
     card_free(c42);
-    struct card* c43 = card_new(queen, hearts);
-    GString* c43_str = card_str(c43);
-    assert(g_strcmp0(c43_str->str, "queen of hearts") == 0);
-    g_string_free(c43_str, FALSE);
-    card_free(c43);
+    struct card c44 = { spades, 17, in_deck };
+    assert(g_strcmp0(card_str(&c44), "unknown") == 0);
+
+    /* test code() */
+    struct card c45 = { spades, ace, in_deck };
+    assert(g_strcmp0(card_code(&c45), "AS") == 0);
+    struct card c46 = { hearts, ten, in_deck };
+    assert(g_strcmp0(card_code(&c46), "TH") == 0);
+    struct card c47 = { clubs, nine, in_deck };
+    assert(g_strcmp0(card_code(&c47), "9C") == 0);
+
+    /* test parse_code() */
+    struct card c48;
+    assert(card_parse_code("QS", &c48) == 1);
+    assert(c48.rank == queen && c48.suit == spades);
+    assert(card_parse_code("jd", &c48) == 1);
+    assert(c48.rank == jack && c48.suit == diamonds);
+    assert(card_parse_code("XS", &c48) == 0);
+    assert(card_parse_code("", &c48) == 0);
 
     /* test show() */
     struct card* c51 = card_new(ace, spades);
@@ -315,17 +1126,453 @@ card_tests()
 }
 /* ***** */
 
+/* *** card_set *** */
+/* a card_set packs a multiset of cards into a single 64-bit word.
+ * every distinct card owns a 2-bit counter, so a set can hold up to
+ * three copies of a card, and every suit owns a 16-bit lane of which
+ * the low 12 bits are used. the counter for a card lives at
+ *
+ *   bit (16 * suit) + (2 * rank)
+ *
+ * so adding, removing, counting and testing for a card are a shift and
+ * an add or a mask, and the size of a set is two popcounts.
+ */
+#define CARD_SET_NCARDS 24
+#define CARD_SET_FIELD_BITS 2
+#define CARD_SET_LANE_BITS 16
+#define CARD_SET_MAX_COPIES 3
+#define CARD_SET_FIELD_MASK 0x3ULL
+#define CARD_SET_LANE_MASK 0xfffULL
+/* low and high bit of every counter that is in use. */
+#define CARD_SET_LO_BITS 0x0555055505550555ULL
+#define CARD_SET_HI_BITS 0x0aaa0aaa0aaa0aaaULL
+/* the counters of the COUNTERS ranks (ace, ten, king) in every suit. */
+#define CARD_SET_COUNTER_BITS 0x003f003f003f003fULL
+
+struct card_set
+{
+    guint64 bits;
+};
+
+guint32
+card_set_shift(enum rank rank, enum suit suit)
+{
+    return (guint32)suit * CARD_SET_LANE_BITS +
+           (guint32)rank * CARD_SET_FIELD_BITS;
+}
+
+struct card_set
+card_set_empty()
+{
+    struct card_set s = { 0 };
+
+    return s;
+}
+
+/* every card of a single deck, ncopies times over. */
+struct card_set
+card_set_full(guint32 ncopies)
+{
+    struct card_set s = { CARD_SET_LO_BITS * ncopies };
+
+    return s;
+}
+
+guint32
+card_set_count(struct card_set s)
+{
+    return bit_count(s.bits & CARD_SET_LO_BITS) +
+           2 * bit_count(s.bits & CARD_SET_HI_BITS);
+}
+
+guint32
+card_set_count_card(struct card_set s, struct card* c)
+{
+    return (guint32)((s.bits >> card_set_shift(c->rank, c->suit)) &
+                     CARD_SET_FIELD_MASK);
+}
+
+unsigned int
+card_set_contains(struct card_set s, struct card* c)
+{
+    return card_set_count_card(s, c) != 0;
+}
+
+/* returns 1 on success and 0 if the set already holds the maximum
+ * number of copies of the card. */
+unsigned int
+card_set_add(struct card_set* s, struct card* c)
+{
+    if (card_set_count_card(*s, c) == CARD_SET_MAX_COPIES) {
+        return 0;
+    }
+    s->bits += 1ULL << card_set_shift(c->rank, c->suit);
+
+    return 1;
+}
+
+/* returns 1 on success and 0 if the card is not in the set. */
+unsigned int
+card_set_remove(struct card_set* s, struct card* c)
+{
+    if (card_set_count_card(*s, c) == 0) {
+        return 0;
+    }
+    s->bits -= 1ULL << card_set_shift(c->rank, c->suit);
+
+    return 1;
+}
+
+struct card_set
+card_set_suit(struct card_set s, enum suit suit)
+{
+    struct card_set r = {
+        s.bits & (CARD_SET_LANE_MASK << ((guint32)suit * CARD_SET_LANE_BITS))
+    };
+
+    return r;
+}
+
+guint32
+card_set_suit_count(struct card_set s, enum suit suit)
+{
+    return card_set_count(card_set_suit(s, suit));
+}
+
+/* the caller must make sure no counter goes above CARD_SET_MAX_COPIES. */
+struct card_set
+card_set_merge(struct card_set a, struct card_set b)
+{
+    struct card_set r = { a.bits + b.bits };
+
+    return r;
+}
+
+/* the caller must make sure b is contained in a. */
+struct card_set
+card_set_subtract(struct card_set a, struct card_set b)
+{
+    struct card_set r = { a.bits - b.bits };
+
+    return r;
+}
+
+/* how many counter cards (see COUNTERS) are in the set. */
+guint32
+card_set_count_counters(struct card_set s)
+{
+    struct card_set r = { s.bits & CARD_SET_COUNTER_BITS };
+
+    return card_set_count(r);
+}
+
+/* one bit (the low bit of the counter) for every card present. */
+guint64
+card_set_presence(struct card_set s)
+{
+    return (s.bits | (s.bits >> 1)) & CARD_SET_LO_BITS;
+}
+
+/* fills out with the card at position pos, where cards are ordered by
+ * suit and then by rank and copies of a card are adjacent. returns 1 on
+ * success and 0 if pos is out of range. */
+unsigned int
+card_set_nth(struct card_set s, guint32 pos, struct card* out)
+{
+    for (unsigned long i = 0; i < NSUIT; i++) {
+        guint32 in_suit = card_set_suit_count(s, SUITS[i]);
+        if (pos >= in_suit) {
+            pos -= in_suit;
+            continue;
+        }
+        guint64 lane = s.bits >> (SUITS[i] * CARD_SET_LANE_BITS);
+        for (unsigned long j = 0; j < NRANK; j++) {
+            guint32 cnt = (guint32)((lane >> (RANKS[j] * CARD_SET_FIELD_BITS)) &
+                                    CARD_SET_FIELD_MASK);
+            if (pos < cnt) {
+                out->rank = RANKS[j];
+                out->suit = SUITS[i];
+                out->state = in_deck;
+
+                return 1;
+            }
+            pos -= cnt;
+        }
+    }
+
+    return 0;
+}
+
+/* writes the slot (bit offset of the counter) of every card in the set
+ * to slots, one entry per copy, and returns how many were written. slots
+ * must have room for card_set_count(s) entries. a slot is added back to
+ * a set with card_set_add_slot(). */
+guint32
+card_set_slots(struct card_set s, guint8* slots)
+{
+    guint32 n = 0;
+    for (guint32 slot = 0; s.bits != 0;
+         slot += CARD_SET_FIELD_BITS, s.bits >>= CARD_SET_FIELD_BITS) {
+        for (guint64 cnt = s.bits & CARD_SET_FIELD_MASK; cnt > 0; cnt--) {
+            slots[n++] = (guint8)slot;
+        }
+    }
+
+    return n;
+}
+
+void
+card_set_add_slot(struct card_set* s, guint8 slot)
+{
+    s->bits += 1ULL << slot;
+}
+
+void
+card_set_remove_slot(struct card_set* s, guint8 slot)
+{
+    s->bits -= 1ULL << slot;
+}
+
+/* a fourth copy of a card does not fit its counter, so whoever holds more
+ * than three copies keeps the rest in a second set, extra. a copy is only
+ * in extra while s holds three of it, so s alone still tells which cards
+ * are held, and the count is the count of both. */
+void
+card_set_add_slot_extra(struct card_set* s, struct card_set* extra, guint8 slot)
+{
+    if (((s->bits >> slot) & CARD_SET_FIELD_MASK) == CARD_SET_MAX_COPIES) {
+        card_set_add_slot(extra, slot);
+    } else {
+        card_set_add_slot(s, slot);
+    }
+}
+
+void
+card_set_remove_slot_extra(struct card_set* s,
+                           struct card_set* extra,
+                           guint8 slot)
+{
+    if (((extra->bits >> slot) & CARD_SET_FIELD_MASK) != 0) {
+        card_set_remove_slot(extra, slot);
+    } else {
+        card_set_remove_slot(s, slot);
+    }
+}
+
+enum suit
+card_slot_suit(guint8 slot)
+{
+    return (enum suit)(slot / CARD_SET_LANE_BITS);
+}
+
+enum rank
+card_slot_rank(guint8 slot)
+{
+    return (enum rank)((slot % CARD_SET_LANE_BITS) / CARD_SET_FIELD_BITS);
+}
+
+void
+card_slot_card(guint8 slot, struct card* out)
+{
+    out->suit = card_slot_suit(slot);
+    out->rank = card_slot_rank(slot);
+    out->state = in_play;
+}
+
+/* writes the id of every card in the set to ids, numbering the copies of
+ * a card from 0, and returns how many were written. ids must have room for
+ * card_set_count(s) entries. */
+guint32
+card_set_ids(struct card_set s, card_id* ids)
+{
+    guint32 n = 0;
+    for (guint32 slot = 0; s.bits != 0;
+         slot += CARD_SET_FIELD_BITS, s.bits >>= CARD_SET_FIELD_BITS) {
+        guint32 cnt = (guint32)(s.bits & CARD_SET_FIELD_MASK);
+        for (guint32 k = 0; k < cnt; k++) {
+            ids[n++] = card_id_make(
+              card_slot_rank((guint8)slot), card_slot_suit((guint8)slot), k);
+        }
+    }
+
+    return n;
+}
+
+/* the longest string card_set_format() writes: a two letter code and a
+ * separator for every card, and the terminator. */
+#define CARD_SET_STR_MAX (CARD_SET_MAX_COPIES * CARD_SET_NCARDS * 3 + 1)
+
+/* writes the short codes of the cards in s to buf, separated by spaces and
+ * ending in a newline, and returns the length written without the
+ * terminator. buf must have room for CARD_SET_STR_MAX bytes. */
+guint32
+card_set_format(struct card_set s, gchar* buf)
+{
+    guint32 n = 0;
+    for (guint32 slot = 0; s.bits != 0;
+         slot += CARD_SET_FIELD_BITS, s.bits >>= CARD_SET_FIELD_BITS) {
+        guint64 cnt = s.bits & CARD_SET_FIELD_MASK;
+        if (cnt == 0) {
+            /* also skips the unused fields between suit lanes */
+            continue;
+        }
+        const gchar* code =
+          CARD_CODES[card_slot_rank((guint8)slot) * NSUIT +
+                     card_slot_suit((guint8)slot)];
+        for (; cnt > 0; cnt--) {
+            buf[n++] = code[0];
+            buf[n++] = code[1];
+            buf[n++] = ' ';
+        }
+    }
+    if (n > 0) {
+        n--;
+    }
+    buf[n++] = '\n';
+    buf[n] = '\0';
+
+    return n;
+}
+
+/* prints a whole hand to out with one write. */
+void
+card_set_show(struct card_set s, FILE* out)
+{
+    gchar buf[CARD_SET_STR_MAX];
+    guint32 n = card_set_format(s, buf);
+    fwrite(buf, 1, n, out);
+}
+
+void
+card_set_tests()
+{
+    printf("[+] Running tests for card_set.\n");
+
+    struct card* as = card_new(ace, spades);
+    struct card* nc = card_new(nine, clubs);
+
+    /* test empty() and full() */
+    assert(card_set_count(card_set_empty()) == 0);
+    assert(card_set_count(card_set_full(1)) == NRANK * NSUIT);
+    assert(card_set_count(card_set_full(2)) == 2 * NRANK * NSUIT);
+    assert(card_set_count_card(card_set_full(2), as) == 2);
+
+    /* test add() and contains() */
+    struct card_set s11 = card_set_empty();
+    assert(card_set_contains(s11, as) == 0);
+    assert(card_set_add(&s11, as) == 1);
+    assert(card_set_contains(s11, as) == 1);
+    assert(card_set_contains(s11, nc) == 0);
+    assert(card_set_add(&s11, as) == 1);
+    assert(card_set_add(&s11, as) == 1);
+    assert(card_set_add(&s11, as) == 0); /* full */
+    assert(card_set_count(s11) == CARD_SET_MAX_COPIES);
+
+    /* test remove() */
+    struct card_set s21 = card_set_empty();
+    assert(card_set_remove(&s21, as) == 0);
+    card_set_add(&s21, as);
+    card_set_add(&s21, nc);
+    assert(card_set_remove(&s21, as) == 1);
+    assert(card_set_count(s21) == 1);
+    assert(card_set_contains(s21, nc) == 1);
+
+    /* test suit() and suit_count() */
+    struct card_set s31 = card_set_full(2);
+    assert(card_set_suit_count(s31, spades) == 12);
+    assert(card_set_contains(card_set_suit(s31, spades), nc) == 0);
+    assert(card_set_contains(card_set_suit(s31, clubs), nc) == 1);
+
+    /* test merge() and subtract() */
+    struct card_set s41 = card_set_merge(card_set_full(1), card_set_full(1));
+    assert(s41.bits == card_set_full(2).bits);
+    struct card_set s42 = card_set_subtract(s41, card_set_full(1));
+    assert(s42.bits == card_set_full(1).bits);
+
+    /* test count_counters() */
+    assert(card_set_count_counters(card_set_full(2)) == 2 * NCOUNTERS * NSUIT);
+    struct card_set s45 = card_set_empty();
+    card_set_add(&s45, as);
+    card_set_add(&s45, nc);
+    assert(card_set_count_counters(s45) == 1);
+
+    /* test presence() */
+    assert(card_set_presence(card_set_full(2)) == CARD_SET_LO_BITS);
+    assert(card_set_presence(card_set_empty()) == 0);
+
+    /* test nth() */
+    struct card_set s51 = card_set_empty();
+    card_set_add(&s51, nc);
+    card_set_add(&s51, as);
+    card_set_add(&s51, as);
+    struct card c51;
+    assert(card_set_nth(s51, 0, &c51) == 1);
+    assert(card_compare(&c51, nc) == 0);
+    assert(card_set_nth(s51, 1, &c51) == 1);
+    assert(card_compare(&c51, as) == 0);
+    assert(card_set_nth(s51, 2, &c51) == 1);
+    assert(card_compare(&c51, as) == 0);
+    assert(card_set_nth(s51, 3, &c51) == 0);
+
+    /* test slots() and add_slot() */
+    guint8 slots61[CARD_SET_MAX_COPIES * CARD_SET_NCARDS];
+    struct card_set s61 = card_set_full(2);
+    assert(card_set_slots(s61, slots61) == card_set_count(s61));
+    struct card_set s62 = card_set_empty();
+    for (guint32 i = 0; i < card_set_count(s61); i++) {
+        card_set_add_slot(&s62, slots61[i]);
+    }
+    assert(s62.bits == s61.bits);
+
+    /* test ids() agrees with the whole-hand counter mask */
+    card_id ids81[CARD_SET_MAX_COPIES * CARD_SET_NCARDS];
+    assert(card_set_ids(s61, ids81) == card_set_count(s61));
+    assert(card_ids_count_counters(ids81, card_set_count(s61)) ==
+           card_set_count_counters(s61));
+    assert(card_set_ids(s51, ids81) == 3);
+    assert(ids81[0] == card_id_make(nine, clubs, 0));
+    assert(ids81[2] == card_id_make(ace, spades, 1));
+
+    /* test format() and show() */
+    gchar buf71[CARD_SET_STR_MAX];
+    assert(card_set_format(s51, buf71) == 9);
+    assert(g_strcmp0(buf71, "9C AS AS\n") == 0);
+    assert(card_set_format(card_set_empty(), buf71) == 1);
+    assert(g_strcmp0(buf71, "\n") == 0);
+    struct card_set s72 = card_set_full(CARD_SET_MAX_COPIES);
+    assert(card_set_format(s72, buf71) == CARD_SET_STR_MAX - 1);
+    card_set_show(s51, stdout);
+
+    card_free(as);
+    card_free(nc);
+
+    printf("[+] Finished tests for card_set.\n");
+}
+/* ***** */
+
 /* *** card_list *** */
 struct card_list
 {
-    GList* cards;
+    struct card_set cards;
+    struct card_set extra; /* copies past CARD_SET_MAX_COPIES */
 };
 
 struct card_list*
 card_list_new()
 {
     struct card_list* cl = malloc(sizeof(struct card_list));
-    cl->cards = NULL;
+    cl->cards = card_set_empty();
+    cl->extra = card_set_empty();
+
+    return cl;
+}
+
+struct card_list*
+card_list_new_in(struct arena* a)
+{
+    struct card_list* cl = arena_alloc(a, sizeof(struct card_list));
+    cl->cards = card_set_empty();
+    cl->extra = card_set_empty();
 
     return cl;
 }
@@ -339,28 +1586,44 @@ card_list_free(struct card_list* cl)
 void
 card_list_add(struct card_list* cl, struct card* c)
 {
-    cl->cards = g_list_append(cl->cards, c);
+    if (card_set_count_card(cl->cards, c) < CARD_SET_MAX_COPIES) {
+        card_set_add(&cl->cards, c);
+    } else if (card_set_add(&cl->extra, c) == 0) {
+        printf("ERROR: card_list already holds %u copies of that card.\n",
+               2 * CARD_SET_MAX_COPIES);
+    }
 }
 
 unsigned int
 card_list_count(struct card_list* cl)
 {
-    return g_list_length(cl->cards);
+    return card_set_count(cl->cards) + card_set_count(cl->extra);
 }
 
-struct card*
-card_list_remove(struct card_list* cl, guint32 pos)
+/* removes the card at position pos and copies it into out. returns 1 on
+ * success and 0 on error. */
+unsigned int
+card_list_remove(struct card_list* cl, guint32 pos, struct card* out)
 {
-    guint32 len = g_list_length(cl->cards);
-    if (len == 0) {
+    if (card_list_count(cl) == 0) {
         printf("ERROR: Cannot remove card from empty card_list.\n");
 
-        return NULL;
+        return 0;
+    }
+    guint32 nlow = card_set_count(cl->cards);
+    if (card_set_nth(cl->cards, pos, out) == 0 &&
+        (pos < nlow || card_set_nth(cl->extra, pos - nlow, out) == 0)) {
+        printf("ERROR: a card at position %u in the card_list does not "
+               "exist.\n",
+               pos);
+
+        return 0;
     }
-    struct card* c = g_list_nth_data(cl->cards, pos);
-    cl->cards = g_list_remove(cl->cards, c);
+    card_set_remove_slot_extra(
+      &cl->cards, &cl->extra, (guint8)card_set_shift(out->rank, out->suit));
+    out->state = in_play;
 
-    return c;
+    return 1;
 }
 
 void
@@ -370,14 +1633,19 @@ card_list_tests()
 
     /* test creation */
     struct card_list* cl11 = card_list_new();
-    assert(cl11->cards == NULL);
+    assert(card_set_count(cl11->cards) == 0);
     card_list_free(cl11);
+    struct arena* a12 = arena_new(64);
+    struct card_list* cl12 = card_list_new_in(a12);
+    assert(card_list_count(cl12) == 0);
+    arena_free(a12);
 
     /* test add() */
     struct card_list* cl21 = card_list_new();
     struct card* c21 = card_new(ace, spades);
     card_list_add(cl21, c21);
-    assert(g_list_length(cl21->cards) == 1);
+    assert(card_set_count(cl21->cards) == 1);
+    card_free(c21);
     card_list_free(cl21);
 
     /* test count() */
@@ -386,18 +1654,36 @@ card_list_tests()
     struct card* c31 = card_new(ace, spades);
     card_list_add(cl31, c31);
     assert(card_list_count(cl31) == 1);
+    card_free(c31);
     card_list_free(cl31);
 
     /* test remove() */
     struct card_list* cl41 = card_list_new();
     struct card* c41 = card_new(ace, spades);
     card_list_add(cl41, c41);
-    struct card* c42 = card_list_remove(cl41, 0);
+    struct card c42;
+    assert(card_list_remove(cl41, 0, &c42) == 1);
     assert(card_list_count(cl41) == 0);
-    assert(card_compare(c41, c42) == 0);
-    assert(card_list_remove(cl41, 0) == NULL);
+    assert(card_compare(c41, &c42) == 0);
+    assert(card_list_remove(cl41, 0, &c42) == 0);
+    card_free(c41);
     card_list_free(cl41);
 
+    /* test a fourth copy goes to extra and comes out first */
+    struct card_list* cl51 = card_list_new();
+    struct card c51 = { hearts, ace, in_deck };
+    for (guint32 i = 0; i < 4; i++) {
+        card_list_add(cl51, &c51);
+    }
+    assert(card_list_count(cl51) == 4);
+    assert(card_set_count(cl51->cards) == 3);
+    assert(card_set_count(cl51->extra) == 1);
+    struct card c52;
+    assert(card_list_remove(cl51, 3, &c52) == 1);
+    assert(card_compare(&c51, &c52) == 0);
+    assert(cl51->extra.bits == 0 && card_list_count(cl51) == 3);
+    card_list_free(cl51);
+
     printf("[+] Finished tests for card_list.\n");
 }
 /* ***** */
@@ -413,117 +1699,172 @@ card_list_tests()
 const unsigned int DECK_CARD_COUNT = 24;
 struct deck
 {
-    GList* cards;
+    struct card_set cards;
 };
 
+void
+deck_init(struct deck* d)
+{
+    /* one card of each suit for each rank */
+    d->cards = card_set_full(1);
+}
+
 struct deck*
 deck_new()
 {
     struct deck* d = malloc(sizeof(struct deck));
-    d->cards = NULL;
-    /* for each rank, make a card of each suit */
-    for (unsigned long i = 0; i < NRANK; i++) {
-        for (unsigned long j = 0; j < NSUIT; j++) {
-            struct card* cur = card_new(RANKS[i], SUITS[j]);
-            d->cards = g_list_append(d->cards, cur);
-        }
-    }
+    deck_init(d);
 
     return d;
 }
 
-guint32
+struct deck*
+deck_new_in(struct arena* a)
+{
+    struct deck* d = arena_alloc(a, sizeof(struct deck));
+    deck_init(d);
+
+    return d;
+}
+
+guint32
 deck_count(struct deck* d)
 {
-    return g_list_length(d->cards);
+    return card_set_count(d->cards);
 }
 
-struct card*
-deck_get(struct deck* d, guint32 pos)
+/* copies the card at position pos into out. returns 1 on success and 0
+ * on error. */
+unsigned int
+deck_get(struct deck* d, guint32 pos, struct card* out)
 {
-    if (pos < deck_count(d)) {
-        struct card* c = g_list_nth_data(d->cards, pos);
-        return c;
+    if (card_set_nth(d->cards, pos, out) == 1) {
+        return 1;
     } else {
         printf("ERROR: a card at position %u in the deck does not exist.\n",
                pos);
-        return NULL;
+        return 0;
     }
 }
 
 void
 deck_free(struct deck* d)
 {
-    // fix this g_list_foreach(d->cards, card_free_gfunc, NULL);
-    for (guint32 i = 0; i < deck_count(d); i++) {
-        card_free(deck_get(d, i));
-    }
     free(d);
 }
 
-struct card*
-deck_draw(struct deck* d, guint32 pos)
+/* removes the card at position pos from the deck and copies it into out.
+ * returns 1 on success and 0 on error. */
+unsigned int
+deck_draw(struct deck* d, guint32 pos, struct card* out)
 {
-    struct card* c = deck_get(d, pos);
-    c->state = in_play;
+    if (deck_get(d, pos, out) == 0) {
+        return 0;
+    }
+    card_set_remove(&d->cards, out);
+    out->state = in_play;
 
-    return c;
+    return 1;
 }
 
-struct card*
-deck_draw_rand(struct deck* d)
+unsigned int
+deck_draw_rand(struct deck* d, struct rng* r, struct card* out)
 {
-    gint32 pos = get_rand_int_range(0, (gint32)deck_count(d));
-    struct card* c = deck_draw(d, (guint32)pos);
+    if (deck_count(d) == 0) {
+        printf("ERROR: Cannot draw a card from an empty deck.\n");
 
-    return c;
+        return 0;
+    }
+    gint32 pos = rng_int_range(r, 0, (gint32)deck_count(d));
+
+    return deck_draw(d, (guint32)pos, out);
 }
 
 void
 deck_add(struct deck* d, struct card* c)
 {
-    d->cards = g_list_append(d->cards, c);
+    if (card_set_add(&d->cards, c) == 0) {
+        printf("ERROR: deck already holds %u copies of that card.\n",
+               CARD_SET_MAX_COPIES);
+    }
 }
 
-gint32
-deck_is_valid(struct deck* d)
+/* a count of every card in a deck, indexed by card id face. the face is a
+ * perfect hash of the 24 cards, so the index is a plain array. */
+struct deck_index
 {
-    if (deck_count(d) > DECK_CARD_COUNT) {
-        return 0;
-    } else {
-        return 1;
+    guint8 counts[CARD_ID_NFACES];
+    guint32 total;
+};
+
+void
+deck_index_from_set(struct card_set s, struct deck_index* out)
+{
+    out->total = 0;
+    for (guint32 f = 0; f < CARD_ID_NFACES; f++) {
+        guint32 slot = card_set_shift(card_id_rank(f), card_id_suit(f));
+        out->counts[f] = (guint8)((s.bits >> slot) & CARD_SET_FIELD_MASK);
+        out->total += out->counts[f];
     }
-    /* TODO check that every card is valid card_is_valid() */
-    /* TODO check that every card is unique */
 }
 
 void
-deck_hash_table_free_value(void* num)
+deck_index_build(struct deck* d, struct deck_index* out)
+{
+    deck_index_from_set(d->cards, out);
+}
+
+guint32
+deck_index_count(struct deck_index* idx, struct card* c)
 {
-    free(num);
+    return idx->counts[card_index(c)];
 }
 
-GHashTable*
-deck_hash_table_new(struct deck* d)
+/* writes b's count less a's for every face to diff and returns how many
+ * faces differ. */
+guint32
+deck_index_diff(struct deck_index* a, struct deck_index* b, gint8* diff)
 {
-    GHashTable* ht = g_hash_table_new_full(
-      g_str_hash, g_str_equal, card_str_free, deck_hash_table_free_value);
-    for (guint32 i = 0; i < deck_count(d); i++) {
-        struct card* c = deck_get(d, i);
-        GString* c_str = card_str(c);
-        guint32* cnt = malloc(sizeof(guint32));
-        *cnt = 1;
-        printf("Adding %s\n", c_str->str);
-        g_hash_table_insert(ht, c_str, cnt);
+    guint32 ndiff = 0;
+    for (guint32 f = 0; f < CARD_ID_NFACES; f++) {
+        diff[f] = (gint8)(b->counts[f] - a->counts[f]);
+        ndiff += diff[f] != 0;
     }
 
-    return ht;
+    return ndiff;
 }
 
-void
-deck_hash_table_free(GHashTable* ht)
+/* 1 if no card appears more than ncopies times. */
+unsigned int
+deck_index_is_valid(struct deck_index* idx, guint32 ncopies)
+{
+    guint32 over = 0;
+    for (guint32 f = 0; f < CARD_ID_NFACES; f++) {
+        over |= idx->counts[f] > ncopies;
+    }
+
+    return over == 0;
+}
+
+/* 1 if s holds only real cards, none of them more than ncopies times. */
+unsigned int
+card_set_is_valid(struct card_set s, guint32 ncopies)
+{
+    /* the top four bits of a suit lane are not cards */
+    if ((s.bits & ~(CARD_SET_LO_BITS | CARD_SET_HI_BITS)) != 0) {
+        return 0;
+    }
+    struct deck_index idx;
+    deck_index_from_set(s, &idx);
+
+    return deck_index_is_valid(&idx, ncopies);
+}
+
+/* 1 if every card in the deck is a valid card and no card is repeated. */
+gint32
+deck_is_valid(struct deck* d)
 {
-    g_hash_table_destroy(ht);
+    return card_set_is_valid(d->cards, 1);
 }
 
 // void deck_str_list_gfunc(gpointer card, gpointer lst)
@@ -559,7 +1900,11 @@ deck_hash_table_free(GHashTable* ht)
 void
 deck_show(struct deck* deck)
 {
-    g_list_foreach(deck->cards, card_show_gfunc, "%s\n");
+    for (guint32 i = 0; i < deck_count(deck); i++) {
+        struct card c;
+        deck_get(deck, i, &c);
+        card_show(&c, "%s\n");
+    }
 }
 
 void
@@ -570,8 +1915,12 @@ deck_tests()
     /* test new() */
     struct deck* d11 = deck_new();
     assert(deck_count(d11) == DECK_CARD_COUNT);
-    assert(g_list_length(d11->cards) == DECK_CARD_COUNT);
+    assert(card_set_count(d11->cards) == DECK_CARD_COUNT);
     deck_free(d11);
+    struct arena* a12 = arena_new(64);
+    struct deck* d12 = deck_new_in(a12);
+    assert(deck_count(d12) == DECK_CARD_COUNT);
+    arena_free(a12);
 
     /* test count() */
     struct deck* d41 = deck_new();
@@ -580,40 +1929,62 @@ deck_tests()
 
     /* test get() */
     struct deck* d21 = deck_new();
-    struct card* c21 = deck_get(d21, 0);
-    assert(c21->rank == ace && c21->suit == clubs);
+    struct card c21;
+    assert(deck_get(d21, 0, &c21) == 1);
+    assert(c21.rank == ace && c21.suit == clubs);
     assert(deck_count(d21) == DECK_CARD_COUNT);
-    struct card* c22 = deck_get(d21, DECK_CARD_COUNT - 2);
-    assert(card_is_valid(c22) == 1);
+    struct card c22;
+    assert(deck_get(d21, DECK_CARD_COUNT - 2, &c22) == 1);
+    assert(card_is_valid(&c22) == 1);
     assert(deck_count(d21) == DECK_CARD_COUNT);
-    struct card* c23 = deck_get(d21, 99); /* this should be an error */
-    assert(c23 == NULL);
+    struct card c23;
+    assert(deck_get(d21, 99, &c23) == 0); /* this should be an error */
     assert(deck_count(d21) == DECK_CARD_COUNT);
     deck_free(d21);
 
     /* test draw() */
     struct deck* d31 = deck_new();
-    struct card* c31 = deck_draw(d31, 0);
-    assert(c31->rank == ace && c31->suit == clubs && c31->state == in_play);
-    // assert(deck_count(d31) == DECK_CARD_COUNT - 1);
-    struct card* c32 = deck_draw(d31, DECK_CARD_COUNT - 2);
-    assert(card_is_valid(c32) == 1);
-    // assert(deck_count(d31) == DECK_CARD_COUNT - 2);
+    struct card c31;
+    assert(deck_draw(d31, 0, &c31) == 1);
+    assert(c31.rank == ace && c31.suit == clubs && c31.state == in_play);
+    assert(deck_count(d31) == DECK_CARD_COUNT - 1);
+    struct card c32;
+    assert(deck_draw(d31, DECK_CARD_COUNT - 2, &c32) == 1);
+    assert(card_is_valid(&c32) == 1);
+    assert(deck_count(d31) == DECK_CARD_COUNT - 2);
     deck_free(d31);
 
     /* test draw_rand() */
     struct deck* d61 = deck_new();
-    struct card* c61 = deck_draw_rand(d61);
-    assert(card_is_valid(c61) == 1);
-    // assert(deck_count(d61) == DECK_CARD_COUNT - 1);
+    struct rng r61;
+    rng_seed(&r61, 1);
+    struct card c61;
+    assert(deck_draw_rand(d61, &r61, &c61) == 1);
+    assert(card_is_valid(&c61) == 1);
+    assert(deck_count(d61) == DECK_CARD_COUNT - 1);
     deck_free(d61);
 
-    /* test hashmap() */
-    // struct deck* d51 = deck_new();
-    // GHashTable* ht51 = deck_hash_table_new(d51);
-    // printf("ht51 count is %u.\nd51 count is %u.\n", g_hash_table_size(ht51),
-    // deck_count(d51)); deck_show(d51); assert(g_hash_table_size(ht51) ==
-    // deck_count(d51)); deck_hash_table_free(ht51); deck_free(d51);
+    /* test index_build() */
+    struct deck* d51 = deck_new();
+    struct deck_index i51;
+    deck_index_build(d51, &i51);
+    assert(i51.total == deck_count(d51));
+    for (guint32 f = 0; f < CARD_ID_NFACES; f++) {
+        assert(i51.counts[f] == 1);
+    }
+    struct card c51;
+    deck_draw(d51, 5, &c51);
+    struct deck_index i52;
+    deck_index_build(d51, &i52);
+    assert(deck_index_count(&i52, &c51) == 0);
+    assert(i52.total == DECK_CARD_COUNT - 1);
+
+    /* test index_diff() */
+    gint8 diff51[CARD_ID_NFACES];
+    assert(deck_index_diff(&i51, &i52, diff51) == 1);
+    assert(diff51[card_index(&c51)] == -1);
+    assert(deck_index_diff(&i51, &i51, diff51) == 0);
+    deck_free(d51);
 
     /* test show() */
     struct deck* d71 = deck_new();
@@ -625,45 +1996,104 @@ deck_tests()
     struct card* c91 = card_new(ace, clubs);
     deck_add(d91, c91);
     assert(deck_count(d91) == DECK_CARD_COUNT + 1);
-    struct card* c92 = deck_get(d91, 0);
-    assert(card_compare(c91, c92) == 0);
+    struct card c92;
+    deck_get(d91, 0, &c92);
+    assert(card_compare(c91, &c92) == 0);
+    card_free(c91);
     deck_free(d91);
 
     /* test is_valid() */
     struct deck* d81 = deck_new();
-    // struct deck *d82 = deck_new();
     assert(deck_is_valid(d81) == 1);
-    // // TODO here
+    struct card c81 = { hearts, king, in_deck };
+    deck_add(d81, &c81);
+    assert(deck_is_valid(d81) == 0);
     deck_free(d81);
-    // deck_free(d82);
+    struct deck* d82 = deck_new();
+    d82->cards.bits |= 1ULL << 14; /* not a card */
+    assert(deck_is_valid(d82) == 0);
+    deck_free(d82);
+    assert(card_set_is_valid(card_set_full(2), 2) == 1);
+    assert(card_set_is_valid(card_set_full(2), 1) == 0);
 
     printf("[+] Finished tests for deck.\n");
 }
 /* ***** */
 
 /* *** pinochle_deck *** */
+/* all decks are kept in one card_set; each card's counter holds how
+ * many of its copies are still in the pinochle deck. the fourth deck
+ * goes in extra, and four decks make the 80 card deck, which has no
+ * nines. */
 const guint32 NDECKS = 2;
+#define PINOCHLE_DECK_MAX_DECKS 4
 struct pinochle_deck
 {
-    GList* deck_pool;
+    struct card_set cards;
+    struct card_set extra; /* copies past CARD_SET_MAX_COPIES */
     guint32 ndecks;
 };
 
+/* puts every card back in the deck. */
+void
+pinochle_deck_fill(struct pinochle_deck* pd)
+{
+    guint32 low = pd->ndecks < CARD_SET_MAX_COPIES ? pd->ndecks
+                                                    : CARD_SET_MAX_COPIES;
+    pd->cards = card_set_full(low);
+    pd->extra = card_set_full(pd->ndecks - low);
+    if (pd->extra.bits != 0) {
+        for (unsigned long i = 0; i < NSUIT; i++) {
+            guint32 shift = card_set_shift(nine, SUITS[i]);
+            pd->cards.bits &= ~(CARD_SET_FIELD_MASK << shift);
+            pd->extra.bits &= ~(CARD_SET_FIELD_MASK << shift);
+        }
+    }
+}
+
 struct pinochle_deck*
 pinochle_deck_new(guint32 ndecks)
 {
+    if (ndecks > PINOCHLE_DECK_MAX_DECKS) {
+        printf("ERROR: a pinochle_deck holds at most %u decks.\n",
+               PINOCHLE_DECK_MAX_DECKS);
+
+        return NULL;
+    }
     struct pinochle_deck* pd = malloc(sizeof(struct pinochle_deck));
-    pd->deck_pool = NULL;
-    for (guint32 i = 0; i < ndecks; i++) {
-        struct deck* d = deck_new();
-        pd->deck_pool = g_list_append(pd->deck_pool, d);
+    pd->ndecks = ndecks;
+    pinochle_deck_fill(pd);
+
+    return pd;
+}
+
+struct pinochle_deck*
+pinochle_deck_new_in(struct arena* a, guint32 ndecks)
+{
+    if (ndecks > PINOCHLE_DECK_MAX_DECKS) {
+        printf("ERROR: a pinochle_deck holds at most %u decks.\n",
+               PINOCHLE_DECK_MAX_DECKS);
+
+        return NULL;
     }
+    struct pinochle_deck* pd = arena_alloc(a, sizeof(struct pinochle_deck));
     pd->ndecks = ndecks;
+    pinochle_deck_fill(pd);
 
     return pd;
 }
 
-/* TODO add get() and draw() and is_valid() functions */
+/* 1 if every card is a valid card and none appears more than once per
+ * deck. */
+unsigned int
+pinochle_deck_is_valid(struct pinochle_deck* pd)
+{
+    guint32 low = pd->ndecks < CARD_SET_MAX_COPIES ? pd->ndecks
+                                                    : CARD_SET_MAX_COPIES;
+
+    return card_set_is_valid(pd->cards, low) &&
+           card_set_is_valid(pd->extra, pd->ndecks - low);
+}
 
 void
 pinochle_deck_free(struct pinochle_deck* pd)
@@ -671,53 +2101,78 @@ pinochle_deck_free(struct pinochle_deck* pd)
     free(pd);
 }
 
-struct deck*
-pinochle_deck_get_deck(struct pinochle_deck* pd, guint32 pos)
+guint32
+pinochle_deck_count(struct pinochle_deck* pd)
 {
-    struct deck* d = g_list_nth_data(pd->deck_pool, pos);
-
-    return d;
+    return card_set_count(pd->cards) + card_set_count(pd->extra);
 }
 
-struct deck*
-pinochle_deck_get_deck_rand(struct pinochle_deck* pd)
+/* copies the card at position pos into out. returns 1 on success and 0
+ * on error. */
+unsigned int
+pinochle_deck_get_card(struct pinochle_deck* pd,
+                       guint32 pos,
+                       struct card* out)
 {
-    gint32 rint = get_rand_int_range(0, (gint32)pd->ndecks);
-    struct deck* d = pinochle_deck_get_deck(pd, (guint32)rint);
-
-    return d;
+    guint32 nlow = card_set_count(pd->cards);
+    if (card_set_nth(pd->cards, pos, out) == 1 ||
+        (pos >= nlow && card_set_nth(pd->extra, pos - nlow, out) == 1)) {
+        return 1;
+    } else {
+        printf("ERROR: a card at position %u in the pinochle_deck does not "
+               "exist.\n",
+               pos);
+        return 0;
+    }
 }
 
-struct card*
-pinochle_deck_get_card(struct pinochle_deck* pd,
-                       guint32 deck_pos,
-                       guint32 card_pos)
+unsigned int
+pinochle_deck_draw(struct pinochle_deck* pd, guint32 pos, struct card* out)
 {
-    struct deck* d = pinochle_deck_get_deck(pd, deck_pos);
-    struct card* c = deck_get(d, card_pos);
+    if (pinochle_deck_get_card(pd, pos, out) == 0) {
+        return 0;
+    }
+    card_set_remove_slot_extra(
+      &pd->cards, &pd->extra, (guint8)card_set_shift(out->rank, out->suit));
+    out->state = in_play;
 
-    return c;
+    return 1;
 }
 
-struct card*
-pinochle_deck_draw_rand(struct pinochle_deck* pd)
+unsigned int
+pinochle_deck_draw_rand(struct pinochle_deck* pd,
+                        struct rng* r,
+                        struct card* out)
 {
-    struct deck* d = pinochle_deck_get_deck_rand(pd);
-    struct card* c = deck_draw_rand(d);
+    guint32 count = pinochle_deck_count(pd);
+    if (count == 0) {
+        printf("ERROR: Cannot draw a card from an empty pinochle_deck.\n");
 
-    return c;
+        return 0;
+    }
+    gint32 pos = rng_int_range(r, 0, (gint32)count);
+
+    return pinochle_deck_draw(pd, (guint32)pos, out);
 }
 
-GList*
-pinochle_deck_draw_rand_n(struct pinochle_deck* pd, guint32 ncards)
+/* draws ncards random cards into cl. returns the number of cards drawn. */
+guint32
+pinochle_deck_draw_rand_n(struct pinochle_deck* pd,
+                          struct rng* r,
+                          guint32 ncards,
+                          struct card_list* cl)
 {
-    GList* cards = NULL;
+    guint32 ndrawn = 0;
     for (guint32 i = 0; i < ncards; i++) {
-        struct card* c = pinochle_deck_draw_rand(pd);
-        cards = g_list_append(cards, c);
+        struct card c;
+        if (pinochle_deck_draw_rand(pd, r, &c) == 0) {
+            break;
+        }
+        card_list_add(cl, &c);
+        ndrawn++;
     }
 
-    return cards;
+    return ndrawn;
 }
 
 void
@@ -727,216 +2182,7189 @@ pinochle_deck_tests()
 
     /* test new() */
     struct pinochle_deck* pd11 = pinochle_deck_new(2);
-    assert(g_list_length(pd11->deck_pool) == 2);
+    assert(pinochle_deck_count(pd11) == 2 * DECK_CARD_COUNT);
     assert(pd11->ndecks == 2);
     pinochle_deck_free(pd11);
+    assert(pinochle_deck_new(PINOCHLE_DECK_MAX_DECKS + 1) == NULL);
+    struct arena* a12 = arena_new(64);
+    struct pinochle_deck* pd12 = pinochle_deck_new_in(a12, 2);
+    assert(pinochle_deck_count(pd12) == 2 * DECK_CARD_COUNT);
+    assert(pinochle_deck_new_in(a12, PINOCHLE_DECK_MAX_DECKS + 1) == NULL);
+    assert(pinochle_deck_is_valid(pd12) == 1);
+    struct card c12 = { spades, queen, in_deck };
+    card_set_add(&pd12->cards, &c12);
+    assert(pinochle_deck_is_valid(pd12) == 0);
+    arena_free(a12);
 
-    /* test get_deck() */
-    struct pinochle_deck* pd31 = pinochle_deck_new(2);
-    struct deck* d31 = pinochle_deck_get_deck(pd31, 0);
-    assert(deck_is_valid(d31) == 1);
+    /* test count() */
+    struct pinochle_deck* pd31 = pinochle_deck_new(1);
+    assert(pinochle_deck_count(pd31) == DECK_CARD_COUNT);
     pinochle_deck_free(pd31);
 
-    /* test get_deck_rand() */
-    struct pinochle_deck* pd41 = pinochle_deck_new(2);
-    struct deck* d41 = pinochle_deck_get_deck_rand(pd41);
-    assert(deck_is_valid(d41) == 1);
-    pinochle_deck_free(pd41);
-
     /* test get_card() */
     struct pinochle_deck* pd21 = pinochle_deck_new(2);
-    struct card* c21 = pinochle_deck_get_card(pd21, 0, 0);
-    assert(card_is_valid(c21) == 1);
+    struct card c21;
+    assert(pinochle_deck_get_card(pd21, 0, &c21) == 1);
+    assert(card_is_valid(&c21) == 1);
+    struct card c22;
+    assert(pinochle_deck_get_card(pd21, 1, &c22) == 1);
+    assert(card_compare(&c21, &c22) == 0); /* both copies are adjacent */
+    assert(pinochle_deck_get_card(pd21, 2 * DECK_CARD_COUNT, &c22) == 0);
     pinochle_deck_free(pd21);
 
     /* test draw_rand() */
     struct pinochle_deck* pd51 = pinochle_deck_new(2);
-    struct card* c51 = pinochle_deck_draw_rand(pd51);
-    assert(card_is_valid(c51) == 1);
+    struct rng r51;
+    rng_seed(&r51, 1);
+    struct card c51;
+    assert(pinochle_deck_draw_rand(pd51, &r51, &c51) == 1);
+    assert(card_is_valid(&c51) == 1);
+    assert(pinochle_deck_count(pd51) == 2 * DECK_CARD_COUNT - 1);
     pinochle_deck_free(pd51);
 
     /* test draw_rand_n() */
     struct pinochle_deck* pd61 = pinochle_deck_new(2);
-    GList* cl61 = pinochle_deck_draw_rand_n(pd61, 2);
-    assert(g_list_length(cl61) == 2);
-    for (guint32 i = 0; i < 2; i++) {
-        struct card* c61 = g_list_nth_data(cl61, i);
-        assert(card_is_valid(c61));
-    }
+    struct rng r61;
+    rng_seed(&r61, 1);
+    struct card_list* cl61 = card_list_new();
+    assert(pinochle_deck_draw_rand_n(pd61, &r61, 2, cl61) == 2);
+    assert(card_list_count(cl61) == 2);
+    assert(pinochle_deck_count(pd61) == 2 * DECK_CARD_COUNT - 2);
+    card_list_free(cl61);
     pinochle_deck_free(pd61);
 
+    /* test draw_rand_n() drains the deck without repeats */
+    struct pinochle_deck* pd71 = pinochle_deck_new(2);
+    struct rng r71;
+    rng_seed(&r71, 1);
+    struct card_list* cl71 = card_list_new();
+    assert(pinochle_deck_draw_rand_n(pd71, &r71, 100, cl71) ==
+           2 * DECK_CARD_COUNT);
+    assert(cl71->cards.bits == card_set_full(2).bits);
+    assert(pinochle_deck_count(pd71) == 0);
+    card_list_free(cl71);
+    pinochle_deck_free(pd71);
+
+    /* test the 80 card deck: four of every card but the nines */
+    struct pinochle_deck* pd81 = pinochle_deck_new(4);
+    assert(pinochle_deck_count(pd81) == 80);
+    assert(pinochle_deck_is_valid(pd81) == 1);
+    struct rng r81;
+    rng_seed(&r81, 1);
+    struct card_list* cl81 = card_list_new();
+    assert(pinochle_deck_draw_rand_n(pd81, &r81, 100, cl81) == 80);
+    assert(pinochle_deck_count(pd81) == 0);
+    for (unsigned long i = 0; i < NSUIT; i++) {
+        for (unsigned long j = 0; j < NRANK; j++) {
+            struct card c81 = { SUITS[i], RANKS[j], in_deck };
+            guint32 want81 = RANKS[j] == nine ? 0 : 4;
+            assert(card_set_count_card(cl81->cards, &c81) +
+                     card_set_count_card(cl81->extra, &c81) ==
+                   want81);
+        }
+    }
+    card_list_free(cl81);
+    pinochle_deck_free(pd81);
+
     /* TODO test add() */
 
     printf("[+] Finished tests for pinochle_deck.\n");
 }
 /* ***** */
 
-/* *** player *** */
-const guint32 NPLAYERS =
-  2; /* 4 players can play in 2 teams of 2. is this right? */
-struct player
+/* *** meld *** */
+/* meld values from the bicycle rules (see SOURCES).
+ *
+ *   class A: run (A-10-K-Q-J of trump) 15, double run 150,
+ *            royal marriage (K-Q of trump) 4, marriage (K-Q) 2,
+ *            dix (9 of trump) 1
+ *   class B: pinochle (Q of spades and J of diamonds) 4,
+ *            double pinochle 30
+ *   class C: aces around 10 (100), kings around 8 (80),
+ *            queens around 6 (60), jacks around 4 (40)
+ *
+ * a card can be melded once per class, so the classes add up on their
+ * own. the king and queen of a run are not also a royal marriage.
+ *
+ * evaluation works on the 12-bit suit lanes of a card_set. everything
+ * that only depends on one suit is looked up per lane, pinochles are
+ * looked up from the two counters involved, and arounds are looked up
+ * from the AND of the four lanes' presence and double bits, so scoring a
+ * hand for a trump is a few loads and adds with no branches. */
+#define MELD_LANE_PATTERNS 4096
+
+struct meld
 {
-    guint32 id;
-    GString* name;
-    guint32 is_dealer;
-    struct card_list* hand;
+    guint32 total;
+    guint32 run;
+    guint32 marriage;
+    guint32 dix;
+    guint32 pinochle;
+    guint32 around;
 };
 
-guint32 player_next_id = 0;
-guint32
-player_get_next_id()
+/* suit-local meld of one lane when that suit is trump. */
+struct meld_trump_lane
 {
-    guint32 next_id = player_next_id;
-    player_next_id = player_next_id + 1;
+    guint8 run;
+    guint8 marriage;
+    guint8 dix;
+};
 
-    return next_id;
+/* the tables are generated from meld_build_tables() by
+ * `xmake tables` (which runs `console meld-table meld_table.h`) and
+ * compiled in, so there is nothing to build at startup. they are:
+ *
+ *   MELD_TRUMP_LANE[lane]  suit-local meld of a lane when it is trump
+ *   MELD_PLAIN_LANE[lane]  marriage points of a lane when it is not
+ *   MELD_PINOCHLE[q << 2 | j]  indexed by the counts of the queen of
+ *                              spades and the jack of diamonds
+ *   MELD_AROUND[lane]  indexed by a lane whose counter for each rank is
+ *                      1 if every suit has that rank, 3 if every suit
+ *                      has two, and 0 otherwise */
+#include "meld_table.h"
+
+guint32
+meld_lane_count(guint32 lane, enum rank rank)
+{
+    return (lane >> (rank * CARD_SET_FIELD_BITS)) & CARD_SET_FIELD_MASK;
 }
 
-struct player*
-player_new(const gchar* name, guint32 is_dealer)
+guint32
+meld_min(guint32 a, guint32 b)
 {
-    struct player* p = malloc(sizeof(struct player));
-    p->id = player_get_next_id();
-    p->name = g_string_new(name);
-    p->is_dealer = is_dealer;
-    p->hand = card_list_new();
+    return a < b ? a : b;
+}
 
-    return p;
+guint32
+meld_around_value(guint32 code, guint32 single, guint32 dbl)
+{
+    if (code == 3) {
+        return dbl;
+    } else if (code == 1) {
+        return single;
+    } else {
+        return 0;
+    }
 }
 
 void
-player_free(struct player* p)
+meld_build_tables(struct meld_trump_lane* trump_lane,
+                  guint8* plain_lane,
+                  guint8* pinochle,
+                  guint16* around)
 {
-    g_string_free(p->name, FALSE);
-    card_list_free(p->hand);
-    free(p);
+    for (guint32 lane = 0; lane < MELD_LANE_PATTERNS; lane++) {
+        guint32 a = meld_lane_count(lane, ace);
+        guint32 t = meld_lane_count(lane, ten);
+        guint32 k = meld_lane_count(lane, king);
+        guint32 q = meld_lane_count(lane, queen);
+        guint32 j = meld_lane_count(lane, jack);
+        guint32 n = meld_lane_count(lane, nine);
+
+        guint32 runs = meld_min(meld_min(meld_min(a, t), meld_min(k, q)), j);
+        guint32 marriages = meld_min(k, q);
+        trump_lane[lane].run =
+          (guint8)(runs >= 2 ? 150 + 15 * (runs - 2) : 15 * runs);
+        trump_lane[lane].marriage = (guint8)(4 * (marriages - runs));
+        trump_lane[lane].dix = (guint8)n;
+        plain_lane[lane] = (guint8)(2 * marriages);
+
+        around[lane] = (guint16)(meld_around_value(a, 10, 100) +
+                                 meld_around_value(k, 8, 80) +
+                                 meld_around_value(q, 6, 60) +
+                                 meld_around_value(j, 4, 40));
+    }
+    for (guint32 q = 0; q < 4; q++) {
+        for (guint32 j = 0; j < 4; j++) {
+            guint32 pinochles = meld_min(q, j);
+            pinochle[(q << 2) | j] =
+              (guint8)(pinochles >= 2 ? 30 : 4 * pinochles);
+        }
+    }
 }
 
-int
-player_is_dealer(struct player* p)
+/* writes the tables from meld_build_tables() as C source to path.
+ * returns 1 on success and 0 on error. */
+unsigned int
+meld_write_tables(const char* path)
 {
-    return p->is_dealer;
+    static struct meld_trump_lane trump_lane[MELD_LANE_PATTERNS];
+    static guint8 plain_lane[MELD_LANE_PATTERNS];
+    static guint8 pinochle[16];
+    static guint16 around[MELD_LANE_PATTERNS];
+    meld_build_tables(trump_lane, plain_lane, pinochle, around);
+
+    FILE* f = fopen(path, "w");
+    if (f == NULL) {
+        printf("ERROR: Cannot open %s for writing.\n", path);
+
+        return 0;
+    }
+    fprintf(f, "/* generated by `console meld-table`; do not edit. */\n\n");
+    fprintf(f,
+            "const struct meld_trump_lane MELD_TRUMP_LANE"
+            "[MELD_LANE_PATTERNS] = {\n");
+    for (guint32 i = 0; i < MELD_LANE_PATTERNS; i++) {
+        fprintf(f,
+                "%s{ %u, %u, %u },%s",
+                i % 6 == 0 ? "  " : " ",
+                trump_lane[i].run,
+                trump_lane[i].marriage,
+                trump_lane[i].dix,
+                i % 6 == 5 || i == MELD_LANE_PATTERNS - 1 ? "\n" : "");
+    }
+    fprintf(f, "};\n\n");
+    fprintf(f, "const guint8 MELD_PLAIN_LANE[MELD_LANE_PATTERNS] = {\n");
+    for (guint32 i = 0; i < MELD_LANE_PATTERNS; i++) {
+        fprintf(f,
+                "%s%u,%s",
+                i % 16 == 0 ? "  " : " ",
+                plain_lane[i],
+                i % 16 == 15 ? "\n" : "");
+    }
+    fprintf(f, "};\n\n");
+    fprintf(f, "const guint8 MELD_PINOCHLE[16] = {\n");
+    for (guint32 i = 0; i < 16; i++) {
+        fprintf(f,
+                "%s%u,%s",
+                i % 16 == 0 ? "  " : " ",
+                pinochle[i],
+                i % 16 == 15 ? "\n" : "");
+    }
+    fprintf(f, "};\n\n");
+    fprintf(f, "const guint16 MELD_AROUND[MELD_LANE_PATTERNS] = {\n");
+    for (guint32 i = 0; i < MELD_LANE_PATTERNS; i++) {
+        fprintf(f,
+                "%s%u,%s",
+                i % 12 == 0 ? "  " : " ",
+                around[i],
+                i % 12 == 11 || i == MELD_LANE_PATTERNS - 1 ? "\n" : "");
+    }
+    fprintf(f, "};\n");
+    fclose(f);
+
+    return 1;
 }
 
-void
-player_tests()
+guint32
+meld_lane(struct card_set hand, enum suit suit)
 {
-    printf("[+] Running tests for player.\n");
+    return (guint32)((hand.bits >> (suit * CARD_SET_LANE_BITS)) &
+                     CARD_SET_LANE_MASK);
+}
 
-    /* test get_next_id() */
-    guint32 id31 = player_get_next_id();
-    assert(id31 == 0);
-    guint32 id32 = player_get_next_id();
-    assert(id32 == 1);
+struct meld
+meld_eval(struct card_set hand, enum suit trump)
+{
+    STAT_INC(stat_meld_evals);
+    STAT_TIMER_BEGIN(timer_meld);
+    guint32 l0 = meld_lane(hand, clubs);
+    guint32 l1 = meld_lane(hand, diamonds);
+    guint32 l2 = meld_lane(hand, hearts);
+    guint32 l3 = meld_lane(hand, spades);
+    guint32 lt = meld_lane(hand, trump);
+
+    /* counter is 1 or more in every suit -> low bit, 2 or more -> both */
+    guint64 present = card_set_presence(hand);
+    guint64 doubled = hand.bits & CARD_SET_HI_BITS;
+    guint32 all_present =
+      (guint32)(present & (present >> 16) & (present >> 32) & (present >> 48));
+    guint32 all_doubled =
+      (guint32)(doubled & (doubled >> 16) & (doubled >> 32) & (doubled >> 48));
+    guint32 around = (all_present | all_doubled) & CARD_SET_LANE_MASK;
+
+    guint32 pinochle = (meld_lane_count(l3, queen) << 2) |
+                       meld_lane_count(l1, jack);
+
+    struct meld m;
+    m.run = MELD_TRUMP_LANE[lt].run;
+    m.marriage = MELD_PLAIN_LANE[l0] + MELD_PLAIN_LANE[l1] +
+                 MELD_PLAIN_LANE[l2] + MELD_PLAIN_LANE[l3] -
+                 MELD_PLAIN_LANE[lt] + MELD_TRUMP_LANE[lt].marriage;
+    m.dix = MELD_TRUMP_LANE[lt].dix;
+    m.pinochle = MELD_PINOCHLE[pinochle];
+    m.around = MELD_AROUND[around];
+    m.total = m.run + m.marriage + m.dix + m.pinochle + m.around;
+    STAT_TIMER_END(timer_meld);
+
+    return m;
+}
 
-    /* test new() */
-    GString* n11 = g_string_new("paulie walnuts");
-    struct player* p11 = player_new(n11->str, 0);
-    assert(p11->id == 2);
-    assert(g_string_equal(p11->name, n11) == 1);
-    assert(p11->is_dealer == 0);
-    assert(card_list_count(p11->hand) == 0);
-    g_string_free(n11, FALSE);
-    player_free(p11);
+/* meld of a hand whose copies past CARD_SET_MAX_COPIES are in extra (see
+ * card_set_add_slot_extra()). a copy is only in extra over three of it in
+ * hand, so a fourth copy can only add a fourth run, marriage or dix: a
+ * pinochle or an around already counts double with two. those are what
+ * extra's own lanes score, so they are added from the same tables. */
+struct meld
+meld_eval_extra(struct card_set hand, struct card_set extra, enum suit trump)
+{
+    struct meld m = meld_eval(hand, trump);
+    if (extra.bits == 0) {
+        return m;
+    }
+    guint32 lt = meld_lane(extra, trump);
+    guint32 run = MELD_TRUMP_LANE[lt].run;
+    guint32 marriage = MELD_PLAIN_LANE[meld_lane(extra, clubs)] +
+                       MELD_PLAIN_LANE[meld_lane(extra, diamonds)] +
+                       MELD_PLAIN_LANE[meld_lane(extra, hearts)] +
+                       MELD_PLAIN_LANE[meld_lane(extra, spades)] -
+                       MELD_PLAIN_LANE[lt] + MELD_TRUMP_LANE[lt].marriage;
+    guint32 dix = MELD_TRUMP_LANE[lt].dix;
+    m.run += run;
+    m.marriage += marriage;
+    m.dix += dix;
+    m.total += run + marriage + dix;
+
+    return m;
+}
 
-    /* test is_dealer() */
-    struct player* p21 = player_new("frank sinatra, jr.", 1);
-    assert(player_is_dealer(p21) == 1);
-    player_free(p21);
+guint32
+meld_total(struct card_set hand, enum suit trump)
+{
+    return meld_eval(hand, trump).total;
+}
 
-    /* test hand_count() */
-    struct player* p31 = player_new("yo-yo mendez", 1);
-    assert(player_is_dealer(p31) == 1);
-    player_free(p31);
+/* the trump suit that gives the most meld, and that meld. */
+enum suit
+meld_best_trump_extra(struct card_set hand,
+                      struct card_set extra,
+                      guint32* total)
+{
+    enum suit best = clubs;
+    guint32 best_total = 0;
+    for (unsigned long i = 0; i < NSUIT; i++) {
+        guint32 t = meld_eval_extra(hand, extra, SUITS[i]).total;
+        if (t > best_total) {
+            best = SUITS[i];
+            best_total = t;
+        }
+    }
+    *total = best_total;
 
-    printf("[+] Finished tests for player.\n");
+    return best;
 }
-/* ***** */
 
-/* *** pinochle *** */
-struct pinochle
+enum suit
+meld_best_trump(struct card_set hand, guint32* total)
 {
-    GList* players;
-    struct pinochle_deck* deck;
-};
+    return meld_best_trump_extra(hand, card_set_empty(), total);
+}
 
-struct pinochle*
-pinochle_new(guint32 nplayers, guint32 ndecks, const gchar** names)
+struct card_set
+meld_hand(const enum rank* ranks, const enum suit* suits, guint32 ncards)
 {
-    struct pinochle* pn = malloc(sizeof(struct pinochle));
-    pn->players = NULL;
-    for (guint32 i = 0; i < nplayers; i++) {
-        struct player* p = player_new(names[i], 0);
-        pn->players = g_list_append(pn->players, p);
+    struct card_set s = card_set_empty();
+    for (guint32 i = 0; i < ncards; i++) {
+        struct card c = { suits[i], ranks[i], in_deck };
+        card_set_add(&s, &c);
     }
-    pn->deck = pinochle_deck_new(ndecks);
 
-    /* pick dealer */
-    struct player* dealer = (struct player*)get_rand_list_elem(pn->players);
-    dealer->is_dealer = 1;
-
-    return pn;
+    return s;
 }
 
 void
-pinochle_free(struct pinochle* p)
+meld_tests()
 {
-    for (guint32 i = 0; i < g_list_length(p->players); i++) {
-        player_free(g_list_nth_data(p->players, i));
+    printf("[+] Running tests for meld.\n");
+
+    /* test the compiled-in tables match the rules */
+    static struct meld_trump_lane trump01[MELD_LANE_PATTERNS];
+    static guint8 plain01[MELD_LANE_PATTERNS];
+    static guint8 pinochle01[16];
+    static guint16 around01[MELD_LANE_PATTERNS];
+    meld_build_tables(trump01, plain01, pinochle01, around01);
+    for (guint32 i = 0; i < MELD_LANE_PATTERNS; i++) {
+        assert(trump01[i].run == MELD_TRUMP_LANE[i].run);
+        assert(trump01[i].marriage == MELD_TRUMP_LANE[i].marriage);
+        assert(trump01[i].dix == MELD_TRUMP_LANE[i].dix);
+        assert(plain01[i] == MELD_PLAIN_LANE[i]);
+        assert(around01[i] == MELD_AROUND[i]);
     }
-    g_list_free(p->players);
-    pinochle_deck_free(p->deck);
-    free(p);
+    for (guint32 i = 0; i < 16; i++) {
+        assert(pinochle01[i] == MELD_PINOCHLE[i]);
+    }
+
+    /* test empty hand */
+    assert(meld_total(card_set_empty(), spades) == 0);
+
+    /* test run, and the same cards as a plain marriage */
+    const enum rank r11[] = { ace, ten, king, queen, jack };
+    const enum suit s11[] = { hearts, hearts, hearts, hearts, hearts };
+    struct card_set h11 = meld_hand(r11, s11, 5);
+    struct meld m11 = meld_eval(h11, hearts);
+    assert(m11.run == 15 && m11.marriage == 0 && m11.total == 15);
+    assert(meld_total(h11, spades) == 2);
+
+    /* test run plus an extra royal marriage, and dix */
+    const enum rank r21[] = { ace, ten, king, queen, jack, king, queen, nine };
+    const enum suit s21[] = { clubs, clubs, clubs, clubs,
+                              clubs, clubs, clubs, clubs };
+    struct meld m21 = meld_eval(meld_hand(r21, s21, 8), clubs);
+    assert(m21.run == 15 && m21.marriage == 4 && m21.dix == 1);
+    assert(m21.total == 20);
+
+    /* test double run */
+    struct card_set h31 = card_set_merge(h11, h11);
+    assert(meld_eval(h31, hearts).run == 150);
+    assert(meld_eval(h31, hearts).marriage == 0);
+    assert(meld_eval(h31, diamonds).marriage == 4);
+
+    /* test pinochle and double pinochle */
+    const enum rank r41[] = { queen, jack };
+    const enum suit s41[] = { spades, diamonds };
+    struct card_set h41 = meld_hand(r41, s41, 2);
+    assert(meld_eval(h41, hearts).pinochle == 4);
+    assert(meld_eval(card_set_merge(h41, h41), hearts).pinochle == 30);
+
+    /* test arounds */
+    const enum rank r51[] = { ace, ace, ace, ace, jack, jack, jack, jack };
+    const enum suit s51[] = { clubs, diamonds, hearts, spades,
+                              clubs, diamonds, hearts, spades };
+    struct card_set h51 = meld_hand(r51, s51, 8);
+    assert(meld_eval(h51, hearts).around == 10 + 4);
+    struct card_set h52 = card_set_merge(h51, h51);
+    assert(meld_eval(h52, hearts).around == 100 + 40);
+    /* one suit short of a double around is a single around */
+    struct card c53 = { spades, ace, in_deck };
+    card_set_remove(&h52, &c53);
+    assert(meld_eval(h52, hearts).around == 10 + 40);
+
+    /* test the whole double deck */
+    struct meld m61 = meld_eval(card_set_full(2), spades);
+    assert(m61.run == 150 && m61.dix == 2 && m61.pinochle == 30);
+    assert(m61.marriage == 3 * 4 && m61.around == 280);
+
+    /* test the fourth copies of the 80 card deck add a run and marriages */
+    struct pinochle_deck* pd62 = pinochle_deck_new(4);
+    struct meld m62 = meld_eval(pd62->cards, spades);
+    assert(m62.run == 150 + 15 && m62.marriage == 3 * 2 * 3);
+    struct meld m63 = meld_eval_extra(pd62->cards, pd62->extra, spades);
+    assert(m63.run == 150 + 2 * 15 && m63.marriage == 3 * 2 * 4);
+    assert(m63.dix == 0 && m63.pinochle == 30 && m63.around == 280);
+    assert(m63.total == m62.total + 15 + 3 * 2);
+    assert(meld_eval_extra(pd62->cards, card_set_empty(), spades).total ==
+           m62.total);
+    pinochle_deck_free(pd62);
+
+    /* test best_trump() */
+    guint32 t71 = 0;
+    assert(meld_best_trump(h11, &t71) == hearts);
+    assert(t71 == 15);
+
+    printf("[+] Finished tests for meld.\n");
 }
+/* ***** */
+
+/* *** trick *** */
+/* a trick is the cards played to it as card_set slots, in playing
+ * order, and the position of the card that is winning it. legal plays
+ * are worked out with masks over the 16-bit suit lanes of a hand:
+ *
+ *   - follow the led suit if possible, and beat the winning card if
+ *     possible ("head the trick"),
+ *   - otherwise trump if possible, and beat a winning trump if possible,
+ *   - otherwise play anything.
+ *
+ * higher cards have lower ranks, so the cards of a suit that beat a card
+ * are the counters below its slot in the same lane. of two identical
+ * cards the first one played wins. */
+#define TRICK_MAX_CARDS 4
+
+struct trick
+{
+    guint8 slots[TRICK_MAX_CARDS];
+    guint32 ncards;
+    guint32 winner; /* position in slots of the winning card */
+    guint32 counters;
+};
 
-const guint32 INIT_CARDS_PER_PLAYER = 12;
 void
-pinochle_deal_init(struct pinochle* p)
+trick_clear(struct trick* t)
 {
+    memset(t->slots, 0, sizeof(t->slots));
+    t->ncards = 0;
+    t->winner = 0;
+    t->counters = 0;
 }
 
-void
-pinochle_tests()
+guint64
+trick_lane_mask(guint32 suit)
 {
-    printf("[+] Running tests for pinochle.\n");
+    return CARD_SET_LANE_MASK << (suit * CARD_SET_LANE_BITS);
+}
 
-    /* test new() */
-    const gchar* n11[] = { "frank sinatra, jr.", "silvio dante" };
-    struct pinochle* p11 = pinochle_new(2, 2, n11);
-    assert(g_list_length(p11->players) == 2);
-    assert(p11->deck->ndecks == 2);
-    pinochle_free(p11);
+/* every card that would beat the card in slot. */
+guint64
+trick_beat_mask(guint8 slot, enum suit trump)
+{
+    guint32 suit = card_slot_suit(slot);
+    guint64 higher = ((1ULL << slot) - 1) & trick_lane_mask(suit);
+    guint64 trumps = trick_lane_mask(trump);
 
-    /* test deal_init() */
-    const gchar* n21[] = { "frank sinatra, jr.", "silvio dante" };
-    struct pinochle* p21 = pinochle_new(2, 2, n21);
-    pinochle_deal_init(p21);
-    // player card count should be 12
-    // TODO assert(player_hand_count(g_list_nth_data(p21->players, 0)) == 12);
-    // TODO assert(player_hand_count(g_list_nth_data(p21->players, 1)) == 12);
-    // deck count should decrease by 24
-    // TODO assert(pinochle_deck_count(p21->deck) == 48 - 24);
-    pinochle_free(p21);
+    return suit == trump ? higher : higher | trumps;
+}
 
-    printf("[+] Finished tests for pinochle.\n");
+guint64
+trick_pick(guint64 preferred, guint64 fallback)
+{
+    return preferred != 0 ? preferred : fallback;
 }
-/* ***** */
 
-int
-main(int argc, char** argv)
+struct card_set
+trick_legal(struct trick* t, struct card_set hand, enum suit trump)
+{
+    if (t->ncards == 0) {
+        return hand;
+    }
+    guint64 beat = trick_beat_mask(t->slots[t->winner], trump);
+    guint64 follow = hand.bits & trick_lane_mask(card_slot_suit(t->slots[0]));
+    guint64 trumps = hand.bits & trick_lane_mask(trump);
+
+    struct card_set legal = { trick_pick(
+      trick_pick(follow & beat, follow),
+      trick_pick(trick_pick(trumps & beat, trumps), hand.bits)) };
+
+    return legal;
+}
+
+/* adds the card in slot to the trick. the caller checks it is legal. */
+void
+trick_play(struct trick* t, guint8 slot, enum suit trump)
 {
+    if (t->ncards > 0 &&
+        (trick_beat_mask(t->slots[t->winner], trump) >> slot) & 1) {
+        t->winner = t->ncards;
+    }
+    t->counters += (guint32)((CARD_SET_COUNTER_BITS >> slot) & 1);
+    t->slots[t->ncards++] = slot;
+}
+
+void
+trick_tests()
+{
+    printf("[+] Running tests for trick.\n");
+
+    guint8 as = card_set_shift(ace, spades);
+    guint8 ts = card_set_shift(ten, spades);
+    guint8 ks = card_set_shift(king, spades);
+    guint8 ns = card_set_shift(nine, spades);
+    guint8 ah = card_set_shift(ace, hearts);
+    guint8 jh = card_set_shift(jack, hearts);
+    guint8 nh = card_set_shift(nine, hearts);
+    guint8 qc = card_set_shift(queen, clubs);
+
+    /* test any card can be led */
+    struct trick t11;
+    trick_clear(&t11);
+    struct card_set h11 = card_set_empty();
+    card_set_add_slot(&h11, as);
+    card_set_add_slot(&h11, qc);
+    assert(trick_legal(&t11, h11, hearts).bits == h11.bits);
+
+    /* test must follow suit and head the trick */
+    struct trick t21;
+    trick_clear(&t21);
+    trick_play(&t21, ks, hearts);
+    struct card_set h21 = card_set_empty();
+    card_set_add_slot(&h21, ts);
+    card_set_add_slot(&h21, ns);
+    card_set_add_slot(&h21, ah);
+    struct card_set l21 = trick_legal(&t21, h21, hearts);
+    assert(l21.bits == (1ULL << ts));
+
+    /* test must follow suit when it cannot head the trick */
+    struct trick t31;
+    trick_clear(&t31);
+    trick_play(&t31, as, hearts);
+    struct card_set l31 = trick_legal(&t31, h21, hearts);
+    assert(l31.bits == ((1ULL << ts) | (1ULL << ns)));
+
+    /* test must trump when void, and beat a trump already played */
+    struct trick t41;
+    trick_clear(&t41);
+    trick_play(&t41, qc, hearts);
+    trick_play(&t41, jh, hearts);
+    assert(t41.winner == 1);
+    struct card_set h41 = card_set_empty();
+    card_set_add_slot(&h41, ah);
+    card_set_add_slot(&h41, nh);
+    card_set_add_slot(&h41, as);
+    assert(trick_legal(&t41, h41, hearts).bits == (1ULL << ah));
+    struct card_set h42 = card_set_empty();
+    card_set_add_slot(&h42, nh);
+    card_set_add_slot(&h42, as);
+    assert(trick_legal(&t41, h42, hearts).bits == (1ULL << nh));
+
+    /* test follow suit without heading once the trick is trumped */
+    struct trick t51;
+    trick_clear(&t51);
+    trick_play(&t51, ks, hearts);
+    trick_play(&t51, nh, hearts);
+    assert(trick_legal(&t51, h21, hearts).bits == l31.bits);
+
+    /* test anything goes when void in the led suit and trump */
+    struct card_set h61 = card_set_empty();
+    card_set_add_slot(&h61, as);
+    assert(trick_legal(&t41, h61, hearts).bits == h61.bits);
+
+    /* test the first of two identical cards wins, and counters */
+    struct trick t71;
+    trick_clear(&t71);
+    trick_play(&t71, as, hearts);
+    trick_play(&t71, as, hearts);
+    trick_play(&t71, ns, hearts);
+    assert(t71.winner == 0);
+    assert(t71.counters == 2);
+
+    printf("[+] Finished tests for trick.\n");
+}
+/* ***** */
+
+/* *** bid *** */
+/* auction: starting left of the dealer, each player in turn bids or
+ * passes. a bid must be at least MIN_BID and at least BID_INCREMENT
+ * over the high bid, and no more than MAX_BID, which no hand can make
+ * and which keeps a bid in the 16 bits a logged action has for it. a
+ * player who passes is out of the auction. it
+ * ends when one bidder is left, who then names trump. if everyone
+ * passes, the dealer is stuck with MIN_BID.
+ *
+ * a bid is worth meld plus counters taken in tricks. bid_estimate()
+ * puts a number on a hand without playing it out: meld comes from
+ * meld_eval() and the counters a hand can expect to take from per-lane
+ * tables, both compiled in (see meld_table.h and bid_table.h), so an
+ * estimate is a few table loads per trump. the counter tables are
+ * measured by playing deals out (see sim_bid_tables()). */
+const guint32 MIN_BID = 10;
+const guint32 BID_INCREMENT = 1;
+const guint32 MAX_BID = 1000;
+#define AUCTION_MAX_PLAYERS 4
+#define AUCTION_NO_BIDDER G_MAXUINT32
+
+struct auction
+{
+    guint32 nplayers;
+    guint32 dealer;
+    guint32 to_act;
+    guint32 high_bid;
+    guint32 high_bidder;
+    guint32 passed; /* one bit per seat */
+    guint32 done;
+};
+
+/* expected counters a lane takes when it is trump or not, in tenths of
+ * a point. */
+#include "bid_table.h"
+
+/* a rule of thumb for the tables, which the measured tables lean on for
+ * lanes that seldom come up: aces take about one and a half counters,
+ * tens behind an ace about one, and every trump takes something, more so
+ * in a long suit. */
+void
+bid_prior_tables(guint8* trump_lane, guint8* plain_lane)
+{
+    for (guint32 lane = 0; lane < MELD_LANE_PATTERNS; lane++) {
+        guint32 a = meld_lane_count(lane, ace);
+        guint32 t = meld_lane_count(lane, ten);
+        guint32 k = meld_lane_count(lane, king);
+        guint32 q = meld_lane_count(lane, queen);
+        guint32 j = meld_lane_count(lane, jack);
+        guint32 n = meld_lane_count(lane, nine);
+        guint32 len = a + t + k + q + j + n;
+
+        guint32 guarded = meld_min(t, a);
+        guint32 plain = 15 * a + 10 * guarded + 3 * (t - guarded) + 2 * k;
+        guint32 trump = 15 * a + 12 * t + 9 * k + 6 * (q + j + n);
+        if (len > 4) {
+            trump += 5 * (len - 4);
+        }
+        plain_lane[lane] = (guint8)meld_min(plain, 255);
+        trump_lane[lane] = (guint8)meld_min(trump, 255);
+    }
+}
+
+void
+bid_write_array(FILE* f, const char* name, const guint8* values)
+{
+    fprintf(f, "const guint8 %s[MELD_LANE_PATTERNS] = {\n", name);
+    for (guint32 i = 0; i < MELD_LANE_PATTERNS; i++) {
+        fprintf(f,
+                "%s%u,%s",
+                i % 16 == 0 ? "  " : " ",
+                values[i],
+                i % 16 == 15 ? "\n" : "");
+    }
+    fprintf(f, "};\n");
+}
+
+/* counters the hand is expected to take with trump, in tenths. */
+guint32
+bid_trick_estimate(struct card_set hand, enum suit trump)
+{
+    guint32 lt = meld_lane(hand, trump);
+
+    return BID_PLAIN_LANE[meld_lane(hand, clubs)] +
+           BID_PLAIN_LANE[meld_lane(hand, diamonds)] +
+           BID_PLAIN_LANE[meld_lane(hand, hearts)] +
+           BID_PLAIN_LANE[meld_lane(hand, spades)] - BID_PLAIN_LANE[lt] +
+           BID_TRUMP_LANE[lt];
+}
+
+struct bid_estimate
+{
+    enum suit trump;
+    guint32 meld;
+    guint32 tricks; /* in tenths of a point */
+    guint32 value;  /* meld plus tricks, rounded down */
+};
+
+/* the trump that makes the hand worth the most, and that worth. extra
+ * holds the hand's copies past CARD_SET_MAX_COPIES, whose tricks are
+ * estimated as if they were a hand of their own. */
+struct bid_estimate
+bid_estimate_extra(struct card_set hand, struct card_set extra)
+{
+    struct bid_estimate best = { clubs, 0, 0, 0 };
+    for (unsigned long i = 0; i < NSUIT; i++) {
+        guint32 meld = meld_eval_extra(hand, extra, SUITS[i]).total;
+        guint32 tricks = bid_trick_estimate(hand, SUITS[i]);
+        if (extra.bits != 0) {
+            tricks += bid_trick_estimate(extra, SUITS[i]);
+        }
+        guint32 value = meld + tricks / 10;
+        if (i == 0 || value > best.value) {
+            best.trump = SUITS[i];
+            best.meld = meld;
+            best.tricks = tricks;
+            best.value = value;
+        }
+    }
+
+    return best;
+}
+
+struct bid_estimate
+bid_estimate(struct card_set hand)
+{
+    return bid_estimate_extra(hand, card_set_empty());
+}
+
+void
+auction_begin(struct auction* a, guint32 nplayers, guint32 dealer)
+{
+    a->nplayers = nplayers;
+    a->dealer = dealer;
+    a->to_act = (dealer + 1) % nplayers;
+    a->high_bid = 0;
+    a->high_bidder = AUCTION_NO_BIDDER;
+    a->passed = 0;
+    a->done = 0;
+}
+
+/* the smallest bid the player to act may make. */
+guint32
+auction_min_bid(struct auction* a)
+{
+    if (a->high_bidder == AUCTION_NO_BIDDER) {
+        return MIN_BID;
+    }
+
+    return a->high_bid + BID_INCREMENT;
+}
+
+void
+auction_advance(struct auction* a)
+{
+    guint32 all = (1u << a->nplayers) - 1;
+    guint32 active = all & ~a->passed;
+    if (active == 0) {
+        /* everyone passed; the dealer is stuck */
+        a->high_bid = MIN_BID;
+        a->high_bidder = a->dealer;
+        a->done = 1;
+
+        return;
+    }
+    if (a->high_bidder != AUCTION_NO_BIDDER &&
+        active == (1u << a->high_bidder)) {
+        a->done = 1;
+
+        return;
+    }
+    do {
+        a->to_act = (a->to_act + 1) % a->nplayers;
+    } while ((a->passed >> a->to_act) & 1);
+}
+
+/* the player to act bids value. returns 1 on success and 0 if the bid
+ * is too low or too high or the auction is over. */
+unsigned int
+auction_bid(struct auction* a, guint32 value)
+{
+    if (a->done || value < auction_min_bid(a) || value > MAX_BID) {
+        printf("ERROR: A bid of %u is not allowed now.\n", value);
+
+        return 0;
+    }
+    a->high_bid = value;
+    a->high_bidder = a->to_act;
+    auction_advance(a);
+    STAT_INC(stat_bids);
+
+    return 1;
+}
+
+unsigned int
+auction_pass(struct auction* a)
+{
+    if (a->done) {
+        printf("ERROR: The auction is over.\n");
+
+        return 0;
+    }
+    a->passed |= 1u << a->to_act;
+    auction_advance(a);
+
+    return 1;
+}
+
+/* what the player to act should bid with hand and its fourth copies in
+ * extra, or 0 to pass: keep bidding the minimum while the estimate
+ * covers it. */
+guint32
+auction_decide_extra(struct auction* a,
+                     struct card_set hand,
+                     struct card_set extra)
+{
+    STAT_TIMER_BEGIN(timer_bid);
+    guint32 need = auction_min_bid(a);
+    guint32 bid = 0;
+    if (need <= MAX_BID && bid_estimate_extra(hand, extra).value >= need) {
+        bid = need;
+    }
+    STAT_TIMER_END(timer_bid);
+
+    return bid;
+}
+
+guint32
+auction_decide(struct auction* a, struct card_set hand)
+{
+    return auction_decide_extra(a, hand, card_set_empty());
+}
+
+/* n cards for the high bidder to bury after taking the widow. side suit
+ * tens and kings go first, since they would likely fall to an ace and a
+ * buried counter counts for the bidder, then the side suit small cards,
+ * and trump only if nothing else is left. */
+struct card_set
+bid_bury(struct card_set hand, enum suit trump, guint32 n)
+{
+    static const enum rank order[] = { ten, king, nine, jack, queen, ace };
+    struct card_set out = card_set_empty();
+    for (guint32 pass = 0; pass < 2; pass++) {
+        for (guint32 r = 0; r < NRANK; r++) {
+            for (guint32 suit = 0; suit < NSUIT; suit++) {
+                if ((suit == (guint32)trump) != (pass == 1)) {
+                    continue;
+                }
+                guint8 slot = (guint8)card_set_shift(order[r], (enum suit)suit);
+                while (n > 0 && ((hand.bits >> slot) & CARD_SET_FIELD_MASK)) {
+                    card_set_remove_slot(&hand, slot);
+                    card_set_add_slot(&out, slot);
+                    n--;
+                }
+            }
+        }
+    }
+
+    return out;
+}
+
+void
+bid_tests()
+{
+    printf("[+] Running tests for bid.\n");
+
+    /* test the rule of thumb */
+    static guint8 trump01[MELD_LANE_PATTERNS];
+    static guint8 plain01[MELD_LANE_PATTERNS];
+    bid_prior_tables(trump01, plain01);
+    guint32 ace01 = 1u << (ace * CARD_SET_FIELD_BITS);
+    guint32 ten01 = 1u << (ten * CARD_SET_FIELD_BITS);
+    assert(trump01[0] == 0 && plain01[0] == 0);
+    assert(trump01[ace01] == 15 && plain01[ace01] == 15);
+    assert(plain01[ace01 + ten01] == 25 && plain01[ten01] == 3);
+    assert(trump01[ten01] == 12);
+
+    /* test estimate() picks the suit with the run */
+    const enum rank r11[] = { ace, ten, king, queen, jack, ace, nine };
+    const enum suit s11[] = { hearts, hearts, hearts, hearts,
+                              hearts, spades, clubs };
+    struct card_set h11 = meld_hand(r11, s11, 7);
+    struct bid_estimate e11 = bid_estimate(h11);
+    assert(e11.trump == hearts);
+    assert(e11.meld == 15);
+    assert(e11.value == e11.meld + e11.tricks / 10);
+    assert(bid_trick_estimate(h11, hearts) > bid_trick_estimate(h11, clubs));
+    assert(bid_estimate(card_set_empty()).value == 0);
+    /* cards in extra add to the tricks, and alone make no meld here */
+    struct card_set x11 = card_set_empty();
+    card_set_add_slot(&x11, (guint8)card_set_shift(ace, spades));
+    struct bid_estimate e12 = bid_estimate_extra(h11, x11);
+    assert(e12.trump == hearts && e12.meld == e11.meld);
+    assert(e12.tricks > e11.tricks);
+
+    /* test bidding up to the last bidder */
+    struct auction a21;
+    auction_begin(&a21, 4, 3);
+    assert(a21.to_act == 0);
+    assert(auction_bid(&a21, MIN_BID - 1) == 0);
+    assert(auction_bid(&a21, MIN_BID) == 1);
+    assert(a21.to_act == 1);
+    assert(auction_bid(&a21, MIN_BID) == 0);
+    assert(auction_bid(&a21, MAX_BID + 1) == 0);
+    assert(auction_bid(&a21, 65536 + MIN_BID + 5) == 0);
+    assert(auction_bid(&a21, MIN_BID + 5) == 1);
+    assert(auction_pass(&a21) == 1);
+    assert(auction_pass(&a21) == 1);
+    assert(a21.done == 0 && a21.to_act == 0);
+    assert(auction_pass(&a21) == 1);
+    assert(a21.done == 1);
+    assert(a21.high_bidder == 1 && a21.high_bid == MIN_BID + 5);
+    assert(auction_pass(&a21) == 0);
+
+    /* test the dealer is stuck when everyone passes */
+    struct auction a31;
+    auction_begin(&a31, 2, 0);
+    assert(auction_pass(&a31) == 1);
+    assert(auction_pass(&a31) == 1);
+    assert(a31.done == 1);
+    assert(a31.high_bidder == 0 && a31.high_bid == MIN_BID);
+
+    /* test decide() bids the minimum or passes */
+    struct auction a41;
+    auction_begin(&a41, 2, 0);
+    assert(auction_decide(&a41, card_set_full(1)) == MIN_BID);
+    assert(auction_decide(&a41, card_set_empty()) == 0);
+
+    /* test bury() keeps trump and aces while it can */
+    const enum rank r51[] = { ace, ten, nine, ten, king, nine };
+    const enum suit s51[] = { hearts, hearts, hearts, spades, spades, spades };
+    struct card_set h51 = meld_hand(r51, s51, 6);
+    struct card_set b51 = bid_bury(h51, spades, 3);
+    assert(card_set_count(b51) == 3);
+    assert(card_set_suit_count(b51, hearts) == 3);
+    assert(card_set_suit_count(bid_bury(h51, spades, 4), spades) == 1);
+
+    printf("[+] Finished tests for bid.\n");
+}
+/* ***** */
+
+/* *** canon *** */
+/* hands that differ only by a relabelling of suits play the same, so a
+ * table of per-hand results needs one entry per class of such hands. a
+ * hand is canonicalized relative to the suits that must keep their names:
+ * those lanes stay put, and the other lanes are sorted, largest first,
+ * into the remaining lane positions in suit order. for trick play only
+ * trump is special. meld also names the queen of spades and the jack of
+ * diamonds (a pinochle), so HAND_CANON_MELD() keeps those suits too. with
+ * spades or diamonds trump that leaves two lanes free to sort, but with
+ * clubs or hearts trump it keeps three suits and leaves one, so every
+ * hand is its own class and the meld class saves nothing.
+ *
+ * the dense index of a canonical hand counts the fixed lanes as base
+ * HAND_CANON_NLANES digits in suit order, then ranks the sorted free lanes
+ * as a multiset in the combinatorial number system, so every index below
+ * hand_canon_nindex() is exactly one class. it covers hands of up to two
+ * copies of a card, the double deck every game is dealt from. */
+#define HAND_CANON_MAX_COPIES 2
+/* lane patterns with at most two of each of the six ranks: 3^6. */
+#define HAND_CANON_NLANES 729
+#define HAND_CANON_PLAY(trump) (1u << (trump))
+#define HAND_CANON_MELD(trump)                                                 \
+    ((1u << (trump)) | (1u << spades) | (1u << diamonds))
+
+struct hand_canon
+{
+    struct card_set hand;
+    guint32 fixed; /* one bit per suit that kept its lane */
+    guint8 from[4]; /* lane i of hand is lane from[i] of the original */
+};
+
+/* the base 3 index of a lane, or G_MAXUINT32 if a rank has three copies. */
+guint32
+hand_canon_lane_index(guint32 lane)
+{
+    guint32 index = 0;
+    for (gint32 rank = NRANK - 1; rank >= 0; rank--) {
+        guint32 cnt = meld_lane_count(lane, (enum rank)rank);
+        if (cnt > HAND_CANON_MAX_COPIES) {
+            return G_MAXUINT32;
+        }
+        index = index * (HAND_CANON_MAX_COPIES + 1) + cnt;
+    }
+
+    return index;
+}
+
+guint32
+hand_canon_lane_from_index(guint32 index)
+{
+    guint32 lane = 0;
+    for (guint32 rank = 0; rank < NRANK; rank++) {
+        lane |= (index % (HAND_CANON_MAX_COPIES + 1))
+                << (rank * CARD_SET_FIELD_BITS);
+        index /= HAND_CANON_MAX_COPIES + 1;
+    }
+
+    return lane;
+}
+
+/* n choose k, 0 if k > n. */
+guint64
+hand_canon_choose(guint64 n, guint32 k)
+{
+    if (k > n) {
+        return 0;
+    }
+    guint64 c = 1;
+    for (guint32 i = 1; i <= k; i++) {
+        c = c * (n - k + i) / i;
+    }
+
+    return c;
+}
+
+/* canonicalizes hand keeping the suits in fixed. returns 1 on success and
+ * 0 if the hand has three copies of a card. */
+unsigned int
+hand_canon_make(struct card_set hand, guint32 fixed, struct hand_canon* out)
+{
+    guint32 lanes[NSUIT];
+    guint8 free_suits[NSUIT];
+    guint32 nfree = 0;
+    for (guint32 suit = 0; suit < NSUIT; suit++) {
+        lanes[suit] = meld_lane(hand, (enum suit)suit);
+        if (hand_canon_lane_index(lanes[suit]) == G_MAXUINT32) {
+            printf("ERROR: a hand with three copies of a card has no "
+                   "canonical form.\n");
+
+            return 0;
+        }
+        if (((fixed >> suit) & 1) == 0) {
+            free_suits[nfree++] = (guint8)suit;
+        }
+    }
+    /* sort the free suits by lane, largest first. a tie keeps suit order,
+     * so the mapping back is the same every time. */
+    for (guint32 i = 1; i < nfree; i++) {
+        guint8 s = free_suits[i];
+        guint32 j = i;
+        while (j > 0 && lanes[free_suits[j - 1]] < lanes[s]) {
+            free_suits[j] = free_suits[j - 1];
+            j--;
+        }
+        free_suits[j] = s;
+    }
+
+    out->hand = card_set_empty();
+    out->fixed = fixed;
+    guint32 next = 0;
+    for (guint32 suit = 0; suit < NSUIT; suit++) {
+        guint8 src = ((fixed >> suit) & 1) ? (guint8)suit : free_suits[next++];
+        out->from[suit] = src;
+        out->hand.bits |= (guint64)lanes[src] << (suit * CARD_SET_LANE_BITS);
+    }
+
+    return 1;
+}
+
+/* the slot in the original hand of a slot in the canonical one, such as
+ * a play found for the canonical hand. */
+guint8
+hand_canon_slot_back(const struct hand_canon* c, guint8 slot)
+{
+    guint32 suit = card_slot_suit(slot);
+
+    return (guint8)(slot - suit * CARD_SET_LANE_BITS +
+                    c->from[suit] * CARD_SET_LANE_BITS);
+}
+
+/* how many classes there are when the suits in fixed keep their lanes. */
+guint64
+hand_canon_nindex(guint32 fixed)
+{
+    guint32 nfixed = bit_count(fixed & 0xf);
+    guint64 n = 1;
+    for (guint32 i = 0; i < nfixed; i++) {
+        n *= HAND_CANON_NLANES;
+    }
+
+    return n * hand_canon_choose(HAND_CANON_NLANES + NSUIT - nfixed - 1,
+                                 NSUIT - nfixed);
+}
+
+/* the dense index of a canonical hand. */
+guint64
+hand_canon_index(const struct hand_canon* c)
+{
+    guint64 index = 0;
+    guint32 free_lanes[NSUIT];
+    guint32 nfree = 0;
+    for (guint32 suit = 0; suit < NSUIT; suit++) {
+        guint32 lane =
+          hand_canon_lane_index(meld_lane(c->hand, (enum suit)suit));
+        if ((c->fixed >> suit) & 1) {
+            index = index * HAND_CANON_NLANES + lane;
+        } else {
+            free_lanes[nfree++] = lane;
+        }
+    }
+    /* largest first, so lane + nfree - 1 - i strictly decreases */
+    guint64 rank = 0;
+    for (guint32 i = 0; i < nfree; i++) {
+        rank += hand_canon_choose(free_lanes[i] + nfree - 1 - i, nfree - i);
+    }
+
+    return index * hand_canon_choose(HAND_CANON_NLANES + nfree - 1, nfree) +
+           rank;
+}
+
+/* the canonical hand with the given index. */
+struct card_set
+hand_canon_from_index(guint64 index, guint32 fixed)
+{
+    guint32 nfree = NSUIT - bit_count(fixed & 0xf);
+    guint64 nrank = hand_canon_choose(HAND_CANON_NLANES + nfree - 1, nfree);
+    guint64 rank = index % nrank;
+    index /= nrank;
+
+    guint32 lanes[NSUIT];
+    for (gint32 suit = NSUIT - 1; suit >= 0; suit--) {
+        if ((fixed >> suit) & 1) {
+            lanes[suit] = (guint32)(index % HAND_CANON_NLANES);
+            index /= HAND_CANON_NLANES;
+        }
+    }
+    guint32 free_lanes[NSUIT];
+    for (guint32 i = 0; i < nfree; i++) {
+        guint32 k = nfree - i;
+        guint64 b = k - 1;
+        while (hand_canon_choose(b + 1, k) <= rank) {
+            b++;
+        }
+        rank -= hand_canon_choose(b, k);
+        free_lanes[i] = (guint32)b - (k - 1);
+    }
+
+    struct card_set hand = card_set_empty();
+    guint32 next = 0;
+    for (guint32 suit = 0; suit < NSUIT; suit++) {
+        guint32 lane = ((fixed >> suit) & 1) ? lanes[suit]
+                                              : free_lanes[next++];
+        hand.bits |= (guint64)hand_canon_lane_from_index(lane)
+                     << (suit * CARD_SET_LANE_BITS);
+    }
+
+    return hand;
+}
+
+void
+hand_canon_tests()
+{
+    printf("[+] Running tests for canon.\n");
+
+    /* test lane_index() round-trips every lane of up to two copies */
+    for (guint32 i = 0; i < HAND_CANON_NLANES; i++) {
+        assert(hand_canon_lane_index(hand_canon_lane_from_index(i)) == i);
+    }
+    assert(hand_canon_lane_index(3) == G_MAXUINT32);
+
+    /* test hands with non-trump suits swapped are one class */
+    struct rng r11;
+    rng_seed(&r11, 11);
+    for (guint32 i = 0; i < 1000; i++) {
+        struct card_set h = card_set_empty();
+        for (guint32 k = 0; k < 12; k++) {
+            guint8 slot = (guint8)card_set_shift(
+              (enum rank)rng_int_range(&r11, 0, NRANK),
+              (enum suit)rng_int_range(&r11, 0, NSUIT));
+            if (((h.bits >> slot) & CARD_SET_FIELD_MASK) < 2) {
+                card_set_add_slot(&h, slot);
+            }
+        }
+        /* swap the clubs and hearts lanes */
+        guint64 lc = meld_lane(h, clubs);
+        guint64 lh = meld_lane(h, hearts);
+        guint32 sc = clubs * CARD_SET_LANE_BITS;
+        guint32 sh = hearts * CARD_SET_LANE_BITS;
+        struct card_set g = { (h.bits & ~((CARD_SET_LANE_MASK << sc) |
+                                          (CARD_SET_LANE_MASK << sh))) |
+                              (lc << sh) | (lh << sc) };
+        enum suit trump = (i & 1) ? spades : diamonds;
+        struct hand_canon ch;
+        struct hand_canon cg;
+        assert(hand_canon_make(h, HAND_CANON_PLAY(trump), &ch) == 1);
+        assert(hand_canon_make(g, HAND_CANON_PLAY(trump), &cg) == 1);
+        assert(ch.hand.bits == cg.hand.bits);
+        guint64 index = hand_canon_index(&ch);
+        assert(index == hand_canon_index(&cg));
+        assert(index < hand_canon_nindex(HAND_CANON_PLAY(trump)));
+        assert(hand_canon_from_index(index, HAND_CANON_PLAY(trump)).bits ==
+               ch.hand.bits);
+        /* and play the same */
+        assert(card_set_count_counters(ch.hand) == card_set_count_counters(h));
+        assert(card_set_suit_count(ch.hand, trump) ==
+               card_set_suit_count(h, trump));
+
+        /* test meld is the same for the meld class */
+        struct hand_canon cm;
+        assert(hand_canon_make(h, HAND_CANON_MELD(trump), &cm) == 1);
+        assert(meld_total(cm.hand, trump) == meld_total(h, trump));
+        assert(hand_canon_from_index(hand_canon_index(&cm),
+                                     HAND_CANON_MELD(trump))
+                 .bits == cm.hand.bits);
+
+        /* test slot_back() finds every card in the original hand */
+        for (guint64 left = card_set_presence(ch.hand); left != 0;
+             left &= left - 1) {
+            guint8 slot = (guint8)bit_first(left);
+            guint8 back = hand_canon_slot_back(&ch, slot);
+            assert(((h.bits >> back) & CARD_SET_FIELD_MASK) ==
+                   ((ch.hand.bits >> slot) & CARD_SET_FIELD_MASK));
+            assert(card_slot_rank(back) == card_slot_rank(slot));
+        }
+    }
+
+    /* test the meld class sorts two lanes with spades trump and none with
+     * clubs trump */
+    guint64 n12 = (guint64)HAND_CANON_NLANES * HAND_CANON_NLANES;
+    assert(hand_canon_nindex(HAND_CANON_MELD(spades)) ==
+           n12 * hand_canon_choose(HAND_CANON_NLANES + 1, 2));
+    assert(hand_canon_nindex(HAND_CANON_MELD(clubs)) == n12 * n12);
+
+    /* test the index is dense: the first and last indexes round-trip */
+    guint64 n21 = hand_canon_nindex(HAND_CANON_PLAY(clubs));
+    assert(n21 ==
+           HAND_CANON_NLANES * hand_canon_choose(HAND_CANON_NLANES + 2, 3));
+    for (guint64 i = 0; i < 2000; i++) {
+        guint64 index = i < 1000 ? i : n21 - 1 - (i - 1000);
+        struct card_set h =
+          hand_canon_from_index(index, HAND_CANON_PLAY(clubs));
+        struct hand_canon c;
+        hand_canon_make(h, HAND_CANON_PLAY(clubs), &c);
+        assert(c.hand.bits == h.bits && hand_canon_index(&c) == index);
+    }
+
+    /* test a hand with three copies of a card is refused */
+    struct card_set h31 = card_set_full(3);
+    struct hand_canon c31;
+    assert(hand_canon_make(h31, HAND_CANON_PLAY(clubs), &c31) == 0);
+
+    printf("[+] Finished tests for canon.\n");
+}
+/* ***** */
+
+/* *** batch *** */
+/* scores many hands at once. the hands are laid out as a structure of
+ * arrays: one array of card_set bits in, and one array per result out, so
+ * the kernels stream through memory. counters and suit lengths are
+ * counted with SSSE3 or AVX2 where the cpu has them (picked at run time)
+ * and with a scalar loop otherwise. meld stays on the lookup tables for
+ * every kernel: it is a handful of loads per hand, which vector gathers
+ * do not make cheaper. */
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define BATCH_X86 1
+#else
+#define BATCH_X86 0
+#endif
+
+enum batch_kernel
+{
+    batch_scalar,
+    batch_sse,
+    batch_avx2
+};
+
+struct hand_batch
+{
+    guint32 nhands;
+    const guint64* hands;  /* card_set bits of each hand */
+    guint8* counters;      /* counters held */
+    guint8* suit_len[4];   /* cards held in each suit, indexed by suit */
+    guint16* meld;         /* meld with the best trump */
+    guint8* best_trump;    /* that trump */
+};
+
+/* the fastest kernel this cpu runs. */
+enum batch_kernel
+batch_kernel_best()
+{
+#if BATCH_X86
+    if (__builtin_cpu_supports("avx2")) {
+        return batch_avx2;
+    }
+    if (__builtin_cpu_supports("ssse3")) {
+        return batch_sse;
+    }
+#endif
+
+    return batch_scalar;
+}
+
+/* counts hands [begin, end) one at a time. */
+void
+batch_count_scalar(struct hand_batch* b, guint32 begin, guint32 end)
+{
+    for (guint32 i = begin; i < end; i++) {
+        struct card_set s = { b->hands[i] };
+        b->counters[i] = (guint8)card_set_count_counters(s);
+        for (guint32 suit = 0; suit < NSUIT; suit++) {
+            b->suit_len[suit][i] = (guint8)card_set_suit_count(s, suit);
+        }
+    }
+}
+
+#if BATCH_X86
+/* the vector kernels count a 2-bit counter as the popcount of the field
+ * plus the popcount of its high bit, with a nibble lookup per byte, then
+ * add byte pairs into one 16-bit total per suit lane. */
+__attribute__((target("ssse3"))) __m128i
+batch_lane_counts_sse(__m128i x)
+{
+    const __m128i lut =
+      _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m128i nibble = _mm_set1_epi8(0x0f);
+    const __m128i hi = _mm_set1_epi64x((long long)CARD_SET_HI_BITS);
+    __m128i h = _mm_and_si128(x, hi);
+    __m128i cnt = _mm_add_epi8(
+      _mm_add_epi8(_mm_shuffle_epi8(lut, _mm_and_si128(x, nibble)),
+                   _mm_shuffle_epi8(
+                     lut, _mm_and_si128(_mm_srli_epi16(x, 4), nibble))),
+      _mm_add_epi8(_mm_shuffle_epi8(lut, _mm_and_si128(h, nibble)),
+                   _mm_shuffle_epi8(
+                     lut, _mm_and_si128(_mm_srli_epi16(h, 4), nibble))));
+
+    return _mm_maddubs_epi16(cnt, _mm_set1_epi8(1));
+}
+
+__attribute__((target("ssse3"))) void
+batch_count_sse(struct hand_batch* b, guint32 begin, guint32 end)
+{
+    const __m128i counter_bits =
+      _mm_set1_epi64x((long long)CARD_SET_COUNTER_BITS);
+    const __m128i ones = _mm_set1_epi16(1);
+    guint32 i = begin;
+    for (; i + 2 <= end; i += 2) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(b->hands + i));
+        guint16 len[8];
+        _mm_storeu_si128((__m128i*)len, batch_lane_counts_sse(x));
+        __m128i c = _mm_madd_epi16(
+          batch_lane_counts_sse(_mm_and_si128(x, counter_bits)), ones);
+        c = _mm_add_epi32(c, _mm_srli_epi64(c, 32));
+        guint64 counters[2];
+        _mm_storeu_si128((__m128i*)counters, c);
+        for (guint32 k = 0; k < 2; k++) {
+            b->counters[i + k] = (guint8)counters[k];
+            for (guint32 suit = 0; suit < NSUIT; suit++) {
+                b->suit_len[suit][i + k] = (guint8)len[4 * k + suit];
+            }
+        }
+    }
+    batch_count_scalar(b, i, end);
+}
+
+__attribute__((target("avx2"))) __m256i
+batch_lane_counts_avx2(__m256i x)
+{
+    const __m256i lut = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3,
+                                         1, 2, 2, 3, 2, 3, 3, 4,
+                                         0, 1, 1, 2, 1, 2, 2, 3,
+                                         1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i nibble = _mm256_set1_epi8(0x0f);
+    const __m256i hi = _mm256_set1_epi64x((long long)CARD_SET_HI_BITS);
+    __m256i h = _mm256_and_si256(x, hi);
+    __m256i cnt = _mm256_add_epi8(
+      _mm256_add_epi8(
+        _mm256_shuffle_epi8(lut, _mm256_and_si256(x, nibble)),
+        _mm256_shuffle_epi8(
+          lut, _mm256_and_si256(_mm256_srli_epi16(x, 4), nibble))),
+      _mm256_add_epi8(
+        _mm256_shuffle_epi8(lut, _mm256_and_si256(h, nibble)),
+        _mm256_shuffle_epi8(
+          lut, _mm256_and_si256(_mm256_srli_epi16(h, 4), nibble))));
+
+    return _mm256_maddubs_epi16(cnt, _mm256_set1_epi8(1));
+}
+
+__attribute__((target("avx2"))) void
+batch_count_avx2(struct hand_batch* b, guint32 begin, guint32 end)
+{
+    const __m256i counter_bits =
+      _mm256_set1_epi64x((long long)CARD_SET_COUNTER_BITS);
+    const __m256i ones = _mm256_set1_epi16(1);
+    guint32 i = begin;
+    for (; i + 4 <= end; i += 4) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(b->hands + i));
+        guint16 len[16];
+        _mm256_storeu_si256((__m256i*)len, batch_lane_counts_avx2(x));
+        __m256i c = _mm256_madd_epi16(
+          batch_lane_counts_avx2(_mm256_and_si256(x, counter_bits)), ones);
+        c = _mm256_add_epi32(c, _mm256_srli_epi64(c, 32));
+        guint64 counters[4];
+        _mm256_storeu_si256((__m256i*)counters, c);
+        for (guint32 k = 0; k < 4; k++) {
+            b->counters[i + k] = (guint8)counters[k];
+            for (guint32 suit = 0; suit < NSUIT; suit++) {
+                b->suit_len[suit][i + k] = (guint8)len[4 * k + suit];
+            }
+        }
+    }
+    batch_count_scalar(b, i, end);
+}
+#endif
+
+/* scores every hand in b with the given kernel. a kernel the cpu cannot
+ * run falls back to the scalar one. */
+void
+batch_eval_with(struct hand_batch* b, enum batch_kernel kernel)
+{
+#if BATCH_X86
+    if (kernel == batch_avx2 && __builtin_cpu_supports("avx2")) {
+        batch_count_avx2(b, 0, b->nhands);
+    } else if (kernel >= batch_sse && __builtin_cpu_supports("ssse3")) {
+        batch_count_sse(b, 0, b->nhands);
+    } else {
+        batch_count_scalar(b, 0, b->nhands);
+    }
+#else
+    batch_count_scalar(b, 0, b->nhands);
+#endif
+    for (guint32 i = 0; i < b->nhands; i++) {
+        struct card_set s = { b->hands[i] };
+        guint32 total;
+        b->best_trump[i] = (guint8)meld_best_trump(s, &total);
+        b->meld[i] = (guint16)total;
+    }
+}
+
+void
+batch_eval(struct hand_batch* b)
+{
+    batch_eval_with(b, batch_kernel_best());
+}
+
+void
+batch_tests()
+{
+    printf("[+] Running tests for batch.\n");
+
+    /* test every kernel agrees with the one-hand functions, with a batch
+     * size that leaves a tail for the scalar loop */
+    const guint32 n = 1003;
+    guint64* hands = malloc(n * sizeof(guint64));
+    struct rng r11;
+    rng_seed(&r11, 11);
+    for (guint32 i = 0; i < n; i++) {
+        struct card_set full = card_set_full(i % 3 + 1);
+        guint8 slots[CARD_SET_MAX_COPIES * CARD_SET_NCARDS];
+        guint32 nslots = card_set_slots(full, slots);
+        struct card_set hand = card_set_empty();
+        guint32 ncards = (guint32)rng_int_range(&r11, 0, (gint32)nslots + 1);
+        for (guint32 k = 0; k < ncards; k++) {
+            guint32 pick =
+              (guint32)rng_int_range(&r11, (gint32)k, (gint32)nslots);
+            guint8 tmp = slots[k];
+            slots[k] = slots[pick];
+            slots[pick] = tmp;
+            card_set_add_slot(&hand, slots[k]);
+        }
+        hands[i] = hand.bits;
+    }
+
+    enum batch_kernel kernels[] = { batch_scalar, batch_sse, batch_avx2 };
+    for (guint32 k = 0; k < 3; k++) {
+        guint8* out = calloc(n, 6 * sizeof(guint8));
+        guint16* meld = calloc(n, sizeof(guint16));
+        struct hand_batch b;
+        b.nhands = n;
+        b.hands = hands;
+        b.counters = out;
+        for (guint32 suit = 0; suit < NSUIT; suit++) {
+            b.suit_len[suit] = out + (suit + 1) * n;
+        }
+        b.best_trump = out + 5 * n;
+        b.meld = meld;
+        batch_eval_with(&b, kernels[k]);
+        for (guint32 i = 0; i < n; i++) {
+            struct card_set s = { hands[i] };
+            assert(b.counters[i] == card_set_count_counters(s));
+            for (guint32 suit = 0; suit < NSUIT; suit++) {
+                assert(b.suit_len[suit][i] == card_set_suit_count(s, suit));
+            }
+            guint32 total;
+            assert(b.best_trump[i] == meld_best_trump(s, &total));
+            assert(b.meld[i] == total);
+        }
+        free(meld);
+        free(out);
+    }
+    free(hands);
+
+    printf("[+] Finished tests for batch.\n");
+}
+/* ***** */
+
+/* *** player *** */
+/* the default variant. 3 and 4 players are in PINOCHLE_VARIANTS. */
+const guint32 NPLAYERS = 2;
+struct player
+{
+    guint32 id;
+    gchar* name;
+    guint32 is_dealer;
+    struct card_list* hand;
+    guint32 points; /* counters taken in tricks */
+};
+
+guint32 player_next_id = 0;
+guint32
+player_get_next_id()
+{
+    /* players are created on simulation threads too */
+    guint32 next_id = (guint32)g_atomic_int_add(&player_next_id, 1);
+
+    return next_id;
+}
+
+void
+player_init(struct player* p,
+            gchar* name,
+            guint32 is_dealer,
+            struct card_list* hand)
+{
+    p->id = player_get_next_id();
+    p->name = name;
+    p->is_dealer = is_dealer;
+    p->hand = hand;
+    p->points = 0;
+}
+
+struct player*
+player_new(const gchar* name, guint32 is_dealer)
+{
+    struct player* p = malloc(sizeof(struct player));
+    player_init(p, g_strdup(name), is_dealer, card_list_new());
+
+    return p;
+}
+
+struct player*
+player_new_in(struct arena* a, const gchar* name, guint32 is_dealer)
+{
+    struct player* p = arena_alloc(a, sizeof(struct player));
+    player_init(p, arena_strdup(a, name), is_dealer, card_list_new_in(a));
+
+    return p;
+}
+
+void
+player_free(struct player* p)
+{
+    g_free(p->name);
+    card_list_free(p->hand);
+    free(p);
+}
+
+int
+player_is_dealer(struct player* p)
+{
+    return p->is_dealer;
+}
+
+guint32
+player_hand_count(struct player* p)
+{
+    return card_list_count(p->hand);
+}
+
+void
+player_tests()
+{
+    printf("[+] Running tests for player.\n");
+
+    /* test get_next_id() */
+    guint32 id31 = player_get_next_id();
+    assert(id31 == 0);
+    guint32 id32 = player_get_next_id();
+    assert(id32 == 1);
+
+    /* test new() */
+    GString* n11 = g_string_new("paulie walnuts");
+    struct player* p11 = player_new(n11->str, 0);
+    assert(p11->id == 2);
+    assert(g_strcmp0(p11->name, n11->str) == 0);
+    assert(p11->is_dealer == 0);
+    assert(card_list_count(p11->hand) == 0);
+    g_string_free(n11, TRUE);
+    player_free(p11);
+
+    /* test is_dealer() */
+    struct player* p21 = player_new("frank sinatra, jr.", 1);
+    assert(player_is_dealer(p21) == 1);
+    player_free(p21);
+
+    /* test new_in() */
+    struct arena* a41 = arena_new(256);
+    struct player* p41 = player_new_in(a41, "christopher moltisanti", 0);
+    assert(g_strcmp0(p41->name, "christopher moltisanti") == 0);
+    assert(player_hand_count(p41) == 0);
+    arena_free(a41);
+
+    /* test hand_count() */
+    struct player* p31 = player_new("yo-yo mendez", 1);
+    assert(player_is_dealer(p31) == 1);
+    assert(player_hand_count(p31) == 0);
+    player_free(p31);
+
+    printf("[+] Finished tests for player.\n");
+}
+/* ***** */
+
+/* *** pinochle *** */
+/* a trick takes one card from every seat. */
+#define PINOCHLE_MAX_SEATS TRICK_MAX_CARDS
+/* every card of the 80 card game. */
+#define PINOCHLE_MAX_PLAYS 80
+
+/* the games that can be played, by number of players and decks. all but
+ * one are dealt from up to three decks, usually the 48 card double deck.
+ * three players take fifteen cards each and leave three in the widow,
+ * which the winner of the auction picks up before naming trump, burying
+ * as many cards before the first lead. four players play as two teams of
+ * partners sitting across from each other, seats 0 and 2 against 1 and 3,
+ * and with four decks they play the 80 card game, twenty cards each.
+ *
+ * two-handed is played without its draw. the 24 cards left after the
+ * deal stay in the stock, only the dealt cards are played, and following
+ * suit, trumping and heading apply from the first trick. the real game
+ * has the trick winner draw first while the stock lasts, with no duty to
+ * follow until it is gone. that would deal cards into hands part-way
+ * through the play, which the up-front meld, the bots' view and the
+ * solver do not model.
+ *
+ * meld and bidding read the fourth copies too. the solver and the search
+ * bots look at hands through one card_set and refuse the 80 card game, and
+ * records and the server stay with the smaller decks. */
+struct pinochle_variant
+{
+    const gchar* name;
+    guint32 nplayers;
+    guint32 cards_per_player;
+    guint32 nteams;
+    guint32 widow;  /* cards the auction winner picks up and buries */
+    guint32 ndecks; /* the decks it needs, or 0 for up to three */
+};
+
+const struct pinochle_variant PINOCHLE_VARIANTS[] = {
+    { "two-handed", 2, 12, 2, 0, 0 },
+    { "three-handed", 3, 15, 3, 3, 0 },
+    { "partnership", 4, 12, 2, 0, 0 },
+    { "eighty-card", 4, 20, 2, 0, 4 },
+};
+
+/* the variant for nplayers and ndecks, or NULL if there is none. */
+const struct pinochle_variant*
+pinochle_variant_find(guint32 nplayers, guint32 ndecks)
+{
+    guint32 n = sizeof(PINOCHLE_VARIANTS) / sizeof(PINOCHLE_VARIANTS[0]);
+    for (guint32 i = 0; i < n; i++) {
+        const struct pinochle_variant* v = &PINOCHLE_VARIANTS[i];
+        guint32 fits = v->ndecks == 0 ? ndecks <= CARD_SET_MAX_COPIES
+                                      : ndecks == v->ndecks;
+        if (v->nplayers == nplayers && fits) {
+            return v;
+        }
+    }
+
+    return NULL;
+}
+
+/* everything that changes a game after pinochle_reset() is an action, and
+ * a game logs every action it takes. replaying the log on a game reset to
+ * the same seed rebuilds the game exactly. */
+enum action_kind
+{
+    action_deal,
+    action_auction,
+    action_bid,
+    action_pass,
+    action_trump,
+    action_play,
+    action_widow,
+    action_bury
+};
+
+struct action
+{
+    guint8 kind;   /* an enum action_kind */
+    guint8 seat;   /* who took it */
+    guint16 value; /* the bid (at most MAX_BID), the trump suit, or the card
+                    * slot played or buried */
+};
+
+#define PINOCHLE_ACTIONS_INIT 64
+
+struct pinochle
+{
+    struct arena* arena; /* everything below lives in it */
+    guint32 owns_arena;
+    const struct pinochle_variant* variant;
+    guint32 nplayers;
+    guint32 dealer;
+    /* the seats, in order and inside the game, so the loops over seats
+     * walk one block of memory. players[seat].hand points at hands[seat]
+     * for code that takes a player; the game reads hands[seat]. */
+    struct player players[PINOCHLE_MAX_SEATS];
+    struct card_list hands[PINOCHLE_MAX_SEATS];
+    struct pinochle_deck* deck;
+    guint64 seed;
+    struct rng rng;
+    /* trick play */
+    enum suit trump;
+    guint32 leader; /* seat that led the current trick */
+    struct trick trick;
+    guint32 ntricks;
+    struct auction auction;
+    /* the action log, in the arena. it only grows until the next reset. */
+    struct action* actions;
+    guint32 nactions;
+    guint32 actions_cap;
+};
+
+void
+pinochle_set_dealer(struct pinochle* p, guint32 dealer)
+{
+    p->dealer = dealer;
+    for (guint32 seat = 0; seat < p->nplayers; seat++) {
+        p->players[seat].is_dealer = seat == dealer;
+    }
+}
+
+/* puts every card back in the deck, reseeds the game and picks a new
+ * dealer, so one game can be reused for many deals. */
+void
+pinochle_reset(struct pinochle* p, guint64 seed)
+{
+    p->seed = seed;
+    rng_seed(&p->rng, seed);
+    pinochle_deck_fill(p->deck);
+    for (guint32 i = 0; i < p->nplayers; i++) {
+        p->hands[i].cards = card_set_empty();
+        p->hands[i].extra = card_set_empty();
+        p->players[i].points = 0;
+    }
+    trick_clear(&p->trick);
+    p->ntricks = 0;
+    p->trump = clubs;
+    p->leader = 0;
+    memset(&p->auction, 0, sizeof(p->auction));
+    p->nactions = 0;
+
+    /* pick dealer */
+    gint32 dealer = rng_int_range(&p->rng, 0, (gint32)p->nplayers);
+    pinochle_set_dealer(p, (guint32)dealer);
+}
+
+/* a game is created in the arena a, which must outlive it. every game
+ * owns its random stream, seeded from seed, so games can run on any
+ * thread and the same seed always plays out the same way. returns NULL
+ * if no variant is played by nplayers with ndecks. */
+struct pinochle*
+pinochle_new_in(struct arena* a,
+                guint32 nplayers,
+                guint32 ndecks,
+                const gchar** names,
+                guint64 seed)
+{
+    const struct pinochle_variant* v = pinochle_variant_find(nplayers, ndecks);
+    if (v == NULL) {
+        printf("ERROR: pinochle is not played by %u players with %u decks.\n",
+               nplayers,
+               ndecks);
+
+        return NULL;
+    }
+    struct pinochle* pn = arena_alloc(a, sizeof(struct pinochle));
+    pn->arena = a;
+    pn->owns_arena = 0;
+    pn->variant = v;
+    pn->nplayers = nplayers;
+    for (guint32 i = 0; i < nplayers; i++) {
+        pn->hands[i].cards = card_set_empty();
+        pn->hands[i].extra = card_set_empty();
+        player_init(
+          &pn->players[i], arena_strdup(a, names[i]), 0, &pn->hands[i]);
+    }
+    pn->deck = pinochle_deck_new_in(a, ndecks);
+    if (pn->deck == NULL) {
+        return NULL;
+    }
+    pn->actions_cap = PINOCHLE_ACTIONS_INIT;
+    pn->actions = arena_alloc(a, pn->actions_cap * sizeof(struct action));
+    pinochle_reset(pn, seed);
+
+    return pn;
+}
+
+/* enough for a four player game and its names in one chunk. */
+const gsize PINOCHLE_ARENA_SIZE = 1024;
+
+/* a game in an arena of its own: one allocation to create it and one
+ * to free it. */
+struct pinochle*
+pinochle_new(guint32 nplayers,
+             guint32 ndecks,
+             const gchar** names,
+             guint64 seed)
+{
+    struct arena* a = arena_new(PINOCHLE_ARENA_SIZE);
+    struct pinochle* pn = pinochle_new_in(a, nplayers, ndecks, names, seed);
+    if (pn == NULL) {
+        arena_free(a);
+
+        return NULL;
+    }
+    pn->owns_arena = 1;
+
+    return pn;
+}
+
+/* frees the game's arena if it has its own; a game made with
+ * pinochle_new_in() goes away with its arena. */
+void
+pinochle_free(struct pinochle* p)
+{
+    if (p->owns_arena) {
+        arena_free(p->arena);
+    }
+}
+
+struct player*
+pinochle_player(struct pinochle* p, guint32 seat)
+{
+    return &p->players[seat];
+}
+
+guint32
+pinochle_nplayers(struct pinochle* p)
+{
+    return p->nplayers;
+}
+
+guint32
+pinochle_dealer_seat(struct pinochle* p)
+{
+    return p->dealer;
+}
+
+/* the team seat plays for. every seat is its own team unless partners
+ * play, when seats across from each other share one. */
+guint32
+pinochle_team(struct pinochle* p, guint32 seat)
+{
+    return seat % p->variant->nteams;
+}
+
+/* the points taken by a team's seats together. */
+guint32
+pinochle_team_points(struct pinochle* p, guint32 team)
+{
+    guint32 points = 0;
+    for (guint32 seat = 0; seat < p->nplayers; seat++) {
+        if (pinochle_team(p, seat) == team) {
+            points += p->players[seat].points;
+        }
+    }
+
+    return points;
+}
+
+/* appends to the action log. the log doubles in the arena when full; the
+ * old copy is reclaimed with the arena. */
+void
+pinochle_log(struct pinochle* p,
+             enum action_kind kind,
+             guint32 seat,
+             guint32 value)
+{
+    if (p->nactions == p->actions_cap) {
+        struct action* grown =
+          arena_alloc(p->arena, 2 * p->actions_cap * sizeof(struct action));
+        memcpy(grown, p->actions, p->nactions * sizeof(struct action));
+        p->actions = grown;
+        p->actions_cap *= 2;
+    }
+    struct action* a = &p->actions[p->nactions++];
+    a->kind = (guint8)kind;
+    a->seat = (guint8)seat;
+    a->value = (guint16)value;
+}
+
+/* the most cards a pinochle_deck can hold. */
+#define PINOCHLE_DECK_MAX_CARDS (PINOCHLE_DECK_MAX_DECKS * CARD_SET_NCARDS)
+
+/* shuffles the pinochle deck and deals the variant's cards to every
+ * player, NUM_CARDS_DEALT_AT_ONCE at a time, starting with the player
+ * after the dealer. the deck is flattened into an array of card
+ * slots on the stack and only the part that gets dealt is shuffled (a
+ * partial fisher-yates), so nothing is allocated. returns 1 on success
+ * and 0 if there are not enough cards in the deck. */
+unsigned int
+pinochle_deal_init(struct pinochle* p)
+{
+    STAT_TIMER_BEGIN(timer_deal);
+    guint32 nplayers = p->nplayers;
+    guint32 per_player = p->variant->cards_per_player;
+    guint32 ndeal = nplayers * per_player;
+    guint8 slots[PINOCHLE_DECK_MAX_CARDS];
+    guint32 ncards = card_set_slots(p->deck->cards, slots);
+    ncards += card_set_slots(p->deck->extra, slots + ncards);
+    if (ndeal > ncards) {
+        printf("ERROR: Cannot deal %u cards from a pinochle_deck of %u.\n",
+               ndeal,
+               ncards);
+
+        return 0;
+    }
+
+    for (guint32 i = 0; i < ndeal; i++) {
+        guint32 j = (guint32)rng_int_range(&p->rng, (gint32)i, (gint32)ncards);
+        guint8 tmp = slots[i];
+        slots[i] = slots[j];
+        slots[j] = tmp;
+    }
+
+    /* start left of the dealer, a round at a time */
+    guint32 next = 0;
+    for (guint32 given = 0; given < per_player;
+         given += NUM_CARDS_DEALT_AT_ONCE) {
+        guint32 batch = per_player - given < NUM_CARDS_DEALT_AT_ONCE
+                          ? per_player - given
+                          : NUM_CARDS_DEALT_AT_ONCE;
+        for (guint32 i = 1; i <= nplayers; i++) {
+            struct card_list* hand = &p->hands[(p->dealer + i) % nplayers];
+            for (guint32 k = 0; k < batch; k++) {
+                card_set_add_slot_extra(
+                  &hand->cards, &hand->extra, slots[next++]);
+            }
+        }
+    }
+
+    if (p->deck->extra.bits == 0) {
+        struct card_set dealt = card_set_empty();
+        for (guint32 i = 0; i < ndeal; i++) {
+            card_set_add_slot(&dealt, slots[i]);
+        }
+        p->deck->cards = card_set_subtract(p->deck->cards, dealt);
+    } else {
+        for (guint32 i = 0; i < ndeal; i++) {
+            card_set_remove_slot_extra(
+              &p->deck->cards, &p->deck->extra, slots[i]);
+        }
+    }
+    pinochle_log(p, action_deal, pinochle_dealer_seat(p), 0);
+    STAT_INC(stat_deals);
+    STAT_TIMER_END(timer_deal);
+
+    return 1;
+}
+
+/* points for winning the last trick, on top of its counters. */
+const guint32 LAST_TRICK_POINTS = 1;
+
+/* starts the auction with the player after the dealer. */
+void
+pinochle_auction_begin(struct pinochle* p)
+{
+    auction_begin(&p->auction, pinochle_nplayers(p), pinochle_dealer_seat(p));
+    pinochle_log(p, action_auction, pinochle_dealer_seat(p), 0);
+}
+
+/* the seat to act in the auction bids value. returns 1 on success and 0
+ * if the bid is not allowed. */
+unsigned int
+pinochle_bid(struct pinochle* p, guint32 value)
+{
+    guint32 seat = p->auction.to_act;
+    if (auction_bid(&p->auction, value) == 0) {
+        return 0;
+    }
+    pinochle_log(p, action_bid, seat, value);
+
+    return 1;
+}
+
+unsigned int
+pinochle_pass(struct pinochle* p)
+{
+    guint32 seat = p->auction.to_act;
+    if (auction_pass(&p->auction) == 0) {
+        return 0;
+    }
+    pinochle_log(p, action_pass, seat, 0);
+
+    return 1;
+}
+
+/* starts trick play with trump. the winner of the auction leads if there
+ * was one, otherwise the player after the dealer. */
+void
+pinochle_play_begin(struct pinochle* p, enum suit trump)
+{
+    p->trump = trump;
+    if (WITH_BIDS && p->auction.done) {
+        p->leader = p->auction.high_bidder;
+    } else {
+        p->leader = (pinochle_dealer_seat(p) + 1) % pinochle_nplayers(p);
+    }
+    trick_clear(&p->trick);
+    p->ntricks = 0;
+    pinochle_log(p, action_trump, p->leader, trump);
+}
+
+/* the high bidder picks up the widow. returns 1 on success, and at once
+ * in a game without a widow, and 0 if the auction is not over or the
+ * widow is gone. */
+unsigned int
+pinochle_take_widow(struct pinochle* p)
+{
+    if (p->variant->widow == 0) {
+        return 1;
+    }
+    if (p->auction.done == 0 || pinochle_deck_count(p->deck) == 0) {
+        printf("ERROR: There is no widow to take now.\n");
+
+        return 0;
+    }
+    guint32 bidder = p->auction.high_bidder;
+    guint8 slots[PINOCHLE_DECK_MAX_CARDS];
+    guint32 n = card_set_slots(p->deck->cards, slots);
+    n += card_set_slots(p->deck->extra, slots + n);
+    for (guint32 i = 0; i < n; i++) {
+        card_set_add_slot_extra(
+          &p->hands[bidder].cards, &p->hands[bidder].extra, slots[i]);
+    }
+    p->deck->cards = card_set_empty();
+    p->deck->extra = card_set_empty();
+    pinochle_log(p, action_widow, bidder, 0);
+
+    return 1;
+}
+
+/* how many cards the high bidder has yet to bury: what they hold over a
+ * full hand, until the first lead. */
+guint32
+pinochle_to_bury(struct pinochle* p)
+{
+    if (p->auction.done == 0 || p->ntricks > 0 || p->trick.ncards > 0) {
+        return 0;
+    }
+    guint32 held = card_list_count(&p->hands[p->auction.high_bidder]);
+    guint32 full = p->variant->cards_per_player;
+
+    return held > full ? held - full : 0;
+}
+
+/* the high bidder buries the card in slot. its counters count for them.
+ * returns 1 on success and 0 if they have nothing to bury or do not hold
+ * the card. */
+unsigned int
+pinochle_bury_slot(struct pinochle* p, guint8 slot)
+{
+    guint32 bidder = p->auction.high_bidder;
+    struct card_list* hand = &p->hands[bidder];
+    if (pinochle_to_bury(p) == 0 ||
+        ((hand->cards.bits >> slot) & CARD_SET_FIELD_MASK) == 0) {
+        printf("ERROR: That card cannot be buried now.\n");
+
+        return 0;
+    }
+    card_set_remove_slot_extra(&hand->cards, &hand->extra, slot);
+    struct card_set buried = card_set_empty();
+    card_set_add_slot(&buried, slot);
+    p->players[bidder].points += card_set_count_counters(buried);
+    pinochle_log(p, action_bury, bidder, slot);
+
+    return 1;
+}
+
+/* the high bidder buries what bid_bury() picks. */
+void
+pinochle_bury_best(struct pinochle* p)
+{
+    struct card_set hand = p->hands[p->auction.high_bidder].cards;
+    struct card_set bury = bid_bury(hand, p->trump, pinochle_to_bury(p));
+    while (bury.bits != 0) {
+        guint8 slot = (guint8)bit_first(card_set_presence(bury));
+        card_set_remove_slot(&bury, slot);
+        pinochle_bury_slot(p, slot);
+    }
+}
+
+/* ends the auction the way the bots do: the high bidder picks up the
+ * widow, names the trump bid_estimate() likes best and buries. */
+void
+pinochle_declare_best(struct pinochle* p)
+{
+    pinochle_take_widow(p);
+    struct card_list* hand = &p->hands[p->auction.high_bidder];
+    pinochle_play_begin(p, bid_estimate_extra(hand->cards, hand->extra).trump);
+    pinochle_bury_best(p);
+}
+
+/* what auction_decide() bids for the seat to act, fourth copies and all. */
+guint32
+pinochle_decide_bid(struct pinochle* p)
+{
+    struct card_list* hand = &p->hands[p->auction.to_act];
+
+    return auction_decide_extra(&p->auction, hand->cards, hand->extra);
+}
+
+/* the seat whose turn it is. */
+guint32
+pinochle_to_act(struct pinochle* p)
+{
+    return (p->leader + p->trick.ncards) % pinochle_nplayers(p);
+}
+
+struct card_set
+pinochle_legal_plays(struct pinochle* p)
+{
+    return trick_legal(&p->trick, p->hands[pinochle_to_act(p)].cards, p->trump);
+}
+
+unsigned int
+pinochle_is_over(struct pinochle* p)
+{
+    for (guint32 i = 0; i < p->nplayers; i++) {
+        if (p->hands[i].cards.bits != 0) {
+            return 0;
+        }
+    }
+
+    return p->trick.ncards == 0;
+}
+
+/* plays the card in slot for the seat to act. the caller checks it is
+ * legal. when the trick is complete its winner takes the counters and
+ * leads the next one. */
+void
+pinochle_play_slot(struct pinochle* p, guint8 slot)
+{
+    STAT_TIMER_BEGIN(timer_trick);
+    guint32 nplayers = pinochle_nplayers(p);
+    guint32 seat = pinochle_to_act(p);
+    pinochle_log(p, action_play, seat, slot);
+    card_set_remove_slot_extra(
+      &p->hands[seat].cards, &p->hands[seat].extra, slot);
+    trick_play(&p->trick, slot, p->trump);
+    if (p->trick.ncards == nplayers) {
+        guint32 winner = (p->leader + p->trick.winner) % nplayers;
+        p->players[winner].points += p->trick.counters;
+        if (p->hands[winner].cards.bits == 0) {
+            p->players[winner].points += LAST_TRICK_POINTS;
+        }
+        p->leader = winner;
+        p->ntricks++;
+        trick_clear(&p->trick);
+        STAT_INC(stat_tricks);
+    }
+    STAT_TIMER_END(timer_trick);
+}
+
+/* plays c for the seat to act. returns 1 on success and 0 if the play is
+ * not legal. */
+unsigned int
+pinochle_play(struct pinochle* p, struct card* c)
+{
+    guint8 slot = (guint8)card_set_shift(c->rank, c->suit);
+    if (pinochle_to_bury(p) > 0 ||
+        ((pinochle_legal_plays(p).bits >> slot) & CARD_SET_FIELD_MASK) == 0) {
+        printf("ERROR: That card cannot be played now.\n");
+
+        return 0;
+    }
+    pinochle_play_slot(p, slot);
+
+    return 1;
+}
+
+/* takes the logged action a. returns 1 on success and 0 if it cannot be
+ * taken now. */
+unsigned int
+pinochle_apply(struct pinochle* p, const struct action* a)
+{
+    if (a->kind == action_deal) {
+        return pinochle_deal_init(p);
+    } else if (a->kind == action_auction) {
+        pinochle_auction_begin(p);
+    } else if (a->kind == action_bid) {
+        return pinochle_bid(p, a->value);
+    } else if (a->kind == action_pass) {
+        return pinochle_pass(p);
+    } else if (a->kind == action_trump) {
+        pinochle_play_begin(p, (enum suit)a->value);
+    } else if (a->kind == action_play) {
+        pinochle_play_slot(p, (guint8)a->value);
+    } else if (a->kind == action_widow) {
+        return pinochle_take_widow(p);
+    } else if (a->kind == action_bury) {
+        return pinochle_bury_slot(p, (guint8)a->value);
+    } else {
+        return 0;
+    }
+
+    return 1;
+}
+
+void
+pinochle_tests()
+{
+    printf("[+] Running tests for pinochle.\n");
+
+    /* test new() */
+    const gchar* n11[] = { "frank sinatra, jr.", "silvio dante" };
+    struct pinochle* p11 = pinochle_new(2, 2, n11, 1);
+    assert(pinochle_nplayers(p11) == 2);
+    assert(p11->deck->ndecks == 2);
+    pinochle_free(p11);
+
+    /* test deal_init() */
+    const gchar* n21[] = { "frank sinatra, jr.", "silvio dante" };
+    struct pinochle* p21 = pinochle_new(2, 2, n21, 1);
+    assert(pinochle_deal_init(p21) == 1);
+    // player card count should be 12
+    assert(player_hand_count(pinochle_player(p21, 0)) == 12);
+    assert(player_hand_count(pinochle_player(p21, 1)) == 12);
+    // deck count should decrease by 24
+    assert(pinochle_deck_count(p21->deck) == 48 - 24);
+    /* every card is either still in the deck or in exactly one hand */
+    struct card_set all21 = p21->deck->cards;
+    for (guint32 i = 0; i < 2; i++) {
+        all21 = card_set_merge(all21, p21->hands[i].cards);
+    }
+    assert(all21.bits == card_set_full(2).bits);
+    pinochle_free(p21);
+
+    /* test two-handed play never draws from the stock */
+    struct pinochle* p22 = pinochle_new(2, 2, n21, 22);
+    pinochle_deal_init(p22);
+    pinochle_play_begin(p22, hearts);
+    while (pinochle_is_over(p22) == 0) {
+        struct card_set legal = pinochle_legal_plays(p22);
+        pinochle_play_slot(p22, (guint8)bit_first(card_set_presence(legal)));
+    }
+    assert(p22->ntricks == 12);
+    assert(pinochle_deck_count(p22->deck) == 48 - 24);
+    pinochle_free(p22);
+
+    /* test deal_init() runs out of cards */
+    const gchar* n31[] = { "paulie walnuts", "silvio dante" };
+    struct pinochle* p31 = pinochle_new(2, 1, n31, 1);
+    assert(pinochle_deal_init(p31) == 1);
+    assert(pinochle_deck_count(p31->deck) == 0);
+    assert(pinochle_deal_init(p31) == 0);
+    pinochle_free(p31);
+
+    /* test the same seed deals the same hands */
+    const gchar* n41[] = { "paulie walnuts", "silvio dante" };
+    struct pinochle* p41 = pinochle_new(2, 2, n41, 1234);
+    struct pinochle* p42 = pinochle_new(2, 2, n41, 1234);
+    pinochle_deal_init(p41);
+    pinochle_deal_init(p42);
+    for (guint32 i = 0; i < 2; i++) {
+        struct player* pl41 = pinochle_player(p41, i);
+        struct player* pl42 = pinochle_player(p42, i);
+        assert(pl41->is_dealer == pl42->is_dealer);
+        assert(p41->hands[i].cards.bits == p42->hands[i].cards.bits);
+    }
+    pinochle_free(p41);
+    pinochle_free(p42);
+
+    /* test reset() reproduces a fresh game with the same seed */
+    const gchar* n51[] = { "paulie walnuts", "silvio dante" };
+    struct pinochle* p51 = pinochle_new(2, 2, n51, 99);
+    struct pinochle* p52 = pinochle_new(2, 2, n51, 5);
+    pinochle_deal_init(p51);
+    pinochle_deal_init(p52);
+    pinochle_reset(p52, 99);
+    assert(pinochle_deck_count(p52->deck) == 48);
+    pinochle_deal_init(p52);
+    for (guint32 i = 0; i < 2; i++) {
+        struct player* pl51 = pinochle_player(p51, i);
+        struct player* pl52 = pinochle_player(p52, i);
+        assert(pl51->is_dealer == pl52->is_dealer);
+        assert(p51->hands[i].cards.bits == p52->hands[i].cards.bits);
+    }
+    pinochle_free(p51);
+    pinochle_free(p52);
+
+    /* test play() through a whole hand */
+    const gchar* n61[] = { "paulie walnuts", "silvio dante" };
+    struct pinochle* p61 = pinochle_new(2, 2, n61, 61);
+    pinochle_deal_init(p61);
+    pinochle_play_begin(p61, hearts);
+    assert(pinochle_to_act(p61) != pinochle_dealer_seat(p61));
+    struct card c61 = { spades, ace, in_deck };
+    while (pinochle_is_over(p61) == 0) {
+        struct card_set legal = pinochle_legal_plays(p61);
+        assert(card_set_count(legal) > 0);
+        guint8 slot = (guint8)bit_first(card_set_presence(legal));
+        card_slot_card(slot, &c61);
+        assert(pinochle_play(p61, &c61) == 1);
+    }
+    assert(p61->ntricks == 12);
+    /* the deal, the trump and 24 plays */
+    assert(p61->nactions == 26);
+    assert(p61->actions[0].kind == action_deal);
+    assert(p61->actions[1].kind == action_trump);
+    assert(p61->actions[1].value == hearts);
+    guint32 points61 = 0;
+    for (guint32 i = 0; i < 2; i++) {
+        points61 += pinochle_player(p61, i)->points;
+    }
+    /* the counters in the 24 cards dealt, plus the last trick */
+    guint32 dealt61 = card_set_count_counters(
+      card_set_subtract(card_set_full(2), p61->deck->cards));
+    assert(points61 == dealt61 + LAST_TRICK_POINTS);
+    pinochle_free(p61);
+
+    /* test an auction decides who leads */
+    const gchar* n81[] = { "paulie walnuts", "silvio dante" };
+    struct pinochle* p81 = pinochle_new(2, 2, n81, 81);
+    pinochle_deal_init(p81);
+    pinochle_auction_begin(p81);
+    while (p81->auction.done == 0) {
+        struct card_set hand = p81->hands[p81->auction.to_act].cards;
+        guint32 bid = auction_decide(&p81->auction, hand);
+        if (bid > 0) {
+            pinochle_bid(p81, bid);
+        } else {
+            pinochle_pass(p81);
+        }
+    }
+    struct card_set declarer81 = p81->hands[p81->auction.high_bidder].cards;
+    pinochle_play_begin(p81, bid_estimate(declarer81).trump);
+    assert(pinochle_to_act(p81) == p81->auction.high_bidder);
+    assert(pinochle_take_widow(p81) == 1 && pinochle_to_bury(p81) == 0);
+    pinochle_free(p81);
+
+    /* test the three-handed bidder takes the widow and buries as much */
+    const gchar* n82[] = { "paulie walnuts", "silvio dante", "tony soprano" };
+    struct pinochle* p82 = pinochle_new(3, 2, n82, 82);
+    pinochle_deal_init(p82);
+    struct card_set widow82 = p82->deck->cards;
+    assert(card_set_count(widow82) == 3);
+    assert(pinochle_take_widow(p82) == 0);
+    pinochle_auction_begin(p82);
+    while (p82->auction.done == 0) {
+        pinochle_pass(p82);
+    }
+    guint32 bidder82 = p82->auction.high_bidder;
+    struct card_set hand82 =
+      card_set_merge(p82->hands[bidder82].cards, widow82);
+    assert(pinochle_take_widow(p82) == 1);
+    assert(p82->hands[bidder82].cards.bits == hand82.bits);
+    assert(card_set_count(p82->deck->cards) == 0);
+    assert(pinochle_take_widow(p82) == 0);
+    pinochle_play_begin(p82, hearts);
+    assert(pinochle_to_bury(p82) == 3);
+    /* no lead until the bidder has buried, and only cards they hold */
+    struct card c82;
+    card_set_nth(p82->hands[bidder82].cards, 0, &c82);
+    assert(pinochle_play(p82, &c82) == 0);
+    guint64 missing82 = card_set_presence(card_set_full(1)) &
+                        ~card_set_presence(hand82);
+    assert(pinochle_bury_slot(p82, (guint8)bit_first(missing82)) == 0);
+    pinochle_bury_best(p82);
+    assert(pinochle_to_bury(p82) == 0);
+    assert(card_set_count(p82->hands[bidder82].cards) == 15);
+    assert(pinochle_bury_slot(p82, card_set_shift(c82.rank, c82.suit)) == 0);
+    while (pinochle_is_over(p82) == 0) {
+        struct card_set legal = pinochle_legal_plays(p82);
+        pinochle_play_slot(p82, (guint8)bit_first(card_set_presence(legal)));
+    }
+    /* the buried counters count for the bidder, so every counter is won */
+    guint32 points82 = 0;
+    for (guint32 seat = 0; seat < 3; seat++) {
+        points82 += pinochle_player(p82, seat)->points;
+    }
+    assert(points82 ==
+           card_set_count_counters(card_set_full(2)) + LAST_TRICK_POINTS);
+    pinochle_free(p82);
+
+    /* test play() refuses an illegal card */
+    const gchar* n71[] = { "paulie walnuts", "silvio dante" };
+    struct pinochle* p71 = pinochle_new(2, 1, n71, 71);
+    pinochle_deal_init(p71);
+    pinochle_play_begin(p71, hearts);
+    struct card c71;
+    card_set_nth(p71->hands[pinochle_to_act(p71)].cards, 0, &c71);
+    assert(pinochle_play(p71, &c71) == 1);
+    /* the single deck is dealt out, so the next player cannot hold it */
+    assert(pinochle_play(p71, &c71) == 0);
+    pinochle_free(p71);
+
+    /* test three players get fifteen cards and leave a widow of three */
+    const gchar* n91[] = { "tony", "paulie", "silvio", "christopher" };
+    struct pinochle* p91 = pinochle_new(3, 2, n91, 91);
+    pinochle_deal_init(p91);
+    for (guint32 seat = 0; seat < 3; seat++) {
+        assert(player_hand_count(pinochle_player(p91, seat)) == 15);
+        assert(pinochle_team(p91, seat) == seat);
+    }
+    assert(pinochle_deck_count(p91->deck) == 3);
+    pinochle_play_begin(p91, clubs);
+    while (pinochle_is_over(p91) == 0) {
+        struct card_set legal = pinochle_legal_plays(p91);
+        pinochle_play_slot(p91, (guint8)bit_first(card_set_presence(legal)));
+    }
+    assert(p91->ntricks == 15);
+    pinochle_free(p91);
+
+    /* test partners across the table share their points */
+    struct pinochle* p92 = pinochle_new(4, 2, n91, 92);
+    pinochle_deal_init(p92);
+    assert(pinochle_deck_count(p92->deck) == 0);
+    assert(pinochle_team(p92, 0) == pinochle_team(p92, 2));
+    assert(pinochle_team(p92, 1) == pinochle_team(p92, 3));
+    assert(pinochle_team(p92, 0) != pinochle_team(p92, 1));
+    pinochle_play_begin(p92, diamonds);
+    while (pinochle_is_over(p92) == 0) {
+        struct card_set legal = pinochle_legal_plays(p92);
+        pinochle_play_slot(p92, (guint8)bit_first(card_set_presence(legal)));
+    }
+    guint32 team92 = pinochle_team(p92, 0);
+    assert(pinochle_team_points(p92, team92) ==
+           pinochle_player(p92, 0)->points + pinochle_player(p92, 2)->points);
+    assert(pinochle_team_points(p92, 0) + pinochle_team_points(p92, 1) ==
+           card_set_count_counters(card_set_full(2)) + LAST_TRICK_POINTS);
+    pinochle_free(p92);
+
+    /* test partners play the 80 card game with four decks, holding the
+     * fourth copies in extra */
+    struct pinochle* p93 = pinochle_new(4, 4, n91, 93);
+    assert(g_strcmp0(p93->variant->name, "eighty-card") == 0);
+    assert(pinochle_deck_count(p93->deck) == 80);
+    pinochle_deal_init(p93);
+    assert(pinochle_deck_count(p93->deck) == 0);
+    for (guint32 seat = 0; seat < 4; seat++) {
+        struct card_list* hand93 = &p93->hands[seat];
+        assert(card_list_count(hand93) == 20);
+        for (unsigned long i = 0; i < NSUIT; i++) {
+            struct card c93 = { SUITS[i], nine, in_deck };
+            assert(card_set_count_card(hand93->cards, &c93) == 0);
+        }
+    }
+    pinochle_play_begin(p93, spades);
+    while (pinochle_is_over(p93) == 0) {
+        struct card_set legal = pinochle_legal_plays(p93);
+        pinochle_play_slot(p93, (guint8)bit_first(card_set_presence(legal)));
+    }
+    assert(p93->ntricks == 20);
+    assert(pinochle_team_points(p93, 0) + pinochle_team_points(p93, 1) ==
+           4 * card_set_count_counters(card_set_full(1)) + LAST_TRICK_POINTS);
+    pinochle_reset(p93, 94);
+    assert(pinochle_deck_count(p93->deck) == 80);
+    pinochle_free(p93);
+
+    /* test there is no game for five */
+    assert(pinochle_variant_find(5, 2) == NULL);
+    assert(pinochle_new(5, 2, n91, 93) == NULL);
+    /* nor four decks but for partners, nor more than four */
+    assert(pinochle_new(2, 4, n91, 93) == NULL);
+    assert(pinochle_new(4, PINOCHLE_DECK_MAX_DECKS + 1, n91, 93) == NULL);
+
+    printf("[+] Finished tests for pinochle.\n");
+}
+/* ***** */
+
+/* *** replay *** */
+/* rebuilds any point of a played game from its seed and action log. a
+ * replay keeps a snapshot of the game at the start of every trick and
+ * every REPLAY_SNAPSHOT_EVERY actions in between, so seeking restores the
+ * nearest snapshot and replays at most a few actions. */
+#define REPLAY_SNAPSHOT_EVERY 8
+
+/* the state of a game after nactions actions, without its log. */
+struct pinochle_snapshot
+{
+    guint32 nactions;
+    guint32 dealer;
+    struct rng rng;
+    guint64 hands[AUCTION_MAX_PLAYERS];
+    guint64 hands_extra[AUCTION_MAX_PLAYERS];
+    guint64 stock;
+    guint64 stock_extra;
+    guint32 points[AUCTION_MAX_PLAYERS];
+    guint32 trump;
+    guint32 leader;
+    struct trick trick;
+    guint32 ntricks;
+    struct auction auction;
+};
+
+void
+pinochle_snapshot_take(struct pinochle* p, struct pinochle_snapshot* out)
+{
+    memset(out, 0, sizeof(*out));
+    out->nactions = p->nactions;
+    out->dealer = pinochle_dealer_seat(p);
+    out->rng = p->rng;
+    for (guint32 seat = 0; seat < p->nplayers; seat++) {
+        out->hands[seat] = p->hands[seat].cards.bits;
+        out->hands_extra[seat] = p->hands[seat].extra.bits;
+        out->points[seat] = p->players[seat].points;
+    }
+    out->stock = p->deck->cards.bits;
+    out->stock_extra = p->deck->extra.bits;
+    out->trump = p->trump;
+    out->leader = p->leader;
+    out->trick = p->trick;
+    out->ntricks = p->ntricks;
+    out->auction = p->auction;
+}
+
+/* puts the game in the snapshot's state. the log is left to the caller. */
+void
+pinochle_snapshot_restore(struct pinochle* p,
+                          const struct pinochle_snapshot* s)
+{
+    p->rng = s->rng;
+    for (guint32 seat = 0; seat < p->nplayers; seat++) {
+        p->hands[seat].cards.bits = s->hands[seat];
+        p->hands[seat].extra.bits = s->hands_extra[seat];
+        p->players[seat].points = s->points[seat];
+    }
+    pinochle_set_dealer(p, s->dealer);
+    p->deck->cards.bits = s->stock;
+    p->deck->extra.bits = s->stock_extra;
+    p->trump = (enum suit)s->trump;
+    p->leader = s->leader;
+    p->trick = s->trick;
+    p->ntricks = s->ntricks;
+    p->auction = s->auction;
+}
+
+struct replay
+{
+    guint64 seed;
+    guint32 nplayers;
+    guint32 ndecks;
+    struct action* actions;
+    guint32 nactions;
+    struct pinochle_snapshot* snapshots; /* in order of nactions */
+    guint32 nsnapshots;
+    guint32 snapshots_cap;
+    guint32* trick_starts; /* action that leads each trick */
+    guint32 ntricks;
+};
+
+void
+replay_snapshot(struct replay* r, struct pinochle* p)
+{
+    if (r->nsnapshots == r->snapshots_cap) {
+        r->snapshots_cap = r->snapshots_cap > 0 ? 2 * r->snapshots_cap : 16;
+        r->snapshots =
+          realloc(r->snapshots,
+                  r->snapshots_cap * sizeof(struct pinochle_snapshot));
+    }
+    pinochle_snapshot_take(p, &r->snapshots[r->nsnapshots++]);
+}
+
+/* a replay of p's game so far. it copies the log, so p can go on or be
+ * freed. */
+struct replay*
+replay_new(struct pinochle* p)
+{
+    struct replay* r = malloc(sizeof(struct replay));
+    r->seed = p->seed;
+    r->nplayers = p->nplayers;
+    r->ndecks = p->deck->ndecks;
+    r->nactions = p->nactions;
+    r->actions = malloc((p->nactions + 1) * sizeof(struct action));
+    memcpy(r->actions, p->actions, p->nactions * sizeof(struct action));
+    r->snapshots = NULL;
+    r->nsnapshots = 0;
+    r->snapshots_cap = 0;
+    r->trick_starts = malloc((p->nactions + 1) * sizeof(guint32));
+    r->ntricks = 0;
+
+    /* play the log once on a scratch game, snapshotting as it goes */
+    const gchar* names[AUCTION_MAX_PLAYERS];
+    for (guint32 seat = 0; seat < p->nplayers; seat++) {
+        names[seat] = p->players[seat].name;
+    }
+    struct pinochle* g = pinochle_new(r->nplayers, r->ndecks, names, r->seed);
+    guint32 since = 0;
+    for (guint32 i = 0; i < r->nactions; i++) {
+        guint32 leads = r->actions[i].kind == action_play &&
+                        g->trick.ncards == 0;
+        if (leads) {
+            r->trick_starts[r->ntricks++] = i;
+        }
+        if (i == 0 || leads || since == REPLAY_SNAPSHOT_EVERY) {
+            replay_snapshot(r, g);
+            since = 0;
+        }
+        pinochle_apply(g, &r->actions[i]);
+        since++;
+    }
+    pinochle_free(g);
+
+    return r;
+}
+
+void
+replay_free(struct replay* r)
+{
+    free(r->actions);
+    free(r->snapshots);
+    free(r->trick_starts);
+    free(r);
+}
+
+/* puts p, a game with the replay's players and decks, in the state after
+ * the first n actions, log included. returns 1 on success and 0 if n is
+ * past the end of the log. */
+unsigned int
+replay_seek(struct replay* r, struct pinochle* p, guint32 n)
+{
+    if (n > r->nactions || p->nplayers != r->nplayers) {
+        return 0;
+    }
+    pinochle_reset(p, r->seed);
+    if (r->nsnapshots == 0) {
+        return 1;
+    }
+
+    /* the last snapshot at or before n */
+    guint32 lo = 0;
+    guint32 hi = r->nsnapshots;
+    while (hi - lo > 1) {
+        guint32 mid = (lo + hi) / 2;
+        if (r->snapshots[mid].nactions <= n) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    const struct pinochle_snapshot* s = &r->snapshots[lo];
+    pinochle_snapshot_restore(p, s);
+    for (guint32 i = 0; i < s->nactions; i++) {
+        const struct action* a = &r->actions[i];
+        pinochle_log(p, a->kind, a->seat, a->value);
+    }
+    for (guint32 i = s->nactions; i < n; i++) {
+        pinochle_apply(p, &r->actions[i]);
+    }
+
+    return 1;
+}
+
+/* puts p in the state just before trick t (from 0) is led. */
+unsigned int
+replay_seek_trick(struct replay* r, struct pinochle* p, guint32 t)
+{
+    if (t >= r->ntricks) {
+        return 0;
+    }
+
+    return replay_seek(r, p, r->trick_starts[t]);
+}
+
+/* plays a whole hand for seed: the auction with auction_decide(), the
+ * widow and trump by pinochle_declare_best(), and the first legal card. */
+void
+replay_play_bots(struct pinochle* p)
+{
+    pinochle_deal_init(p);
+    pinochle_auction_begin(p);
+    while (p->auction.done == 0) {
+        guint32 bid = pinochle_decide_bid(p);
+        if (bid > 0) {
+            pinochle_bid(p, bid);
+        } else {
+            pinochle_pass(p);
+        }
+    }
+    pinochle_declare_best(p);
+    while (pinochle_is_over(p) == 0) {
+        struct card_set legal = pinochle_legal_plays(p);
+        pinochle_play_slot(p, (guint8)bit_first(card_set_presence(legal)));
+    }
+}
+
+/* console replay <seed> [trick] */
+int
+replay_main(int argc, char** argv)
+{
+    if (argc < 3) {
+        printf("usage: %s replay <seed> [trick]\n", argv[0]);
+
+        return 1;
+    }
+    guint64 seed = g_ascii_strtoull(argv[2], NULL, 10);
+    guint32 trick = argc > 3 ? (guint32)g_ascii_strtoull(argv[3], NULL, 10)
+                             : 0;
+
+    const gchar* names[] = { "north", "east", "south", "west" };
+    struct pinochle* p = pinochle_new(NPLAYERS, NDECKS, names, seed);
+    replay_play_bots(p);
+    struct replay* r = replay_new(p);
+    if (replay_seek_trick(r, p, trick) == 0) {
+        printf("ERROR: the hand has %u tricks.\n", r->ntricks);
+        replay_free(r);
+        pinochle_free(p);
+
+        return 1;
+    }
+    printf("trick %u, %s to lead, trump %s\n",
+           trick,
+           pinochle_player(p, p->leader)->name,
+           SUIT_NAMES[p->trump]);
+    for (guint32 seat = 0; seat < p->nplayers; seat++) {
+        struct player* pl = pinochle_player(p, seat);
+        printf("%s (%u points): ", pl->name, pl->points);
+        card_set_show(p->hands[seat].cards, stdout);
+    }
+    replay_free(r);
+    pinochle_free(p);
+
+    return 0;
+}
+
+void
+replay_tests()
+{
+    printf("[+] Running tests for replay.\n");
+
+    const gchar* n11[] = { "paulie walnuts", "silvio dante" };
+    struct pinochle* p11 = pinochle_new(2, 2, n11, 11);
+    replay_play_bots(p11);
+    struct replay* r11 = replay_new(p11);
+    assert(r11->ntricks == 12);
+    assert(r11->nsnapshots > r11->ntricks);
+
+    /* test seek() to every action matches replaying from the start */
+    struct pinochle* p12 = pinochle_new(2, 2, n11, 0);
+    struct pinochle* p13 = pinochle_new(2, 2, n11, 0);
+    for (guint32 n = 0; n <= r11->nactions; n++) {
+        assert(replay_seek(r11, p12, n) == 1);
+        pinochle_reset(p13, r11->seed);
+        for (guint32 i = 0; i < n; i++) {
+            assert(pinochle_apply(p13, &r11->actions[i]) == 1);
+        }
+        struct pinochle_snapshot s12;
+        struct pinochle_snapshot s13;
+        pinochle_snapshot_take(p12, &s12);
+        pinochle_snapshot_take(p13, &s13);
+        assert(memcmp(&s12, &s13, sizeof(s12)) == 0);
+        assert(memcmp(p12->actions, p13->actions,
+                      n * sizeof(struct action)) == 0);
+    }
+    assert(replay_seek(r11, p12, r11->nactions + 1) == 0);
+
+    /* test a three-handed game replays through the widow and burial */
+    const gchar* n14[] = { "paulie walnuts", "silvio dante", "tony soprano" };
+    struct pinochle* p14 = pinochle_new(3, 2, n14, 14);
+    struct pinochle* p15 = pinochle_new(3, 2, n14, 0);
+    replay_play_bots(p14);
+    struct replay* r14 = replay_new(p14);
+    assert(r14->ntricks == 15);
+    assert(replay_seek(r14, p15, r14->nactions) == 1);
+    for (guint32 seat = 0; seat < 3; seat++) {
+        assert(pinochle_player(p15, seat)->points ==
+               pinochle_player(p14, seat)->points);
+    }
+    replay_free(r14);
+    pinochle_free(p15);
+    pinochle_free(p14);
+
+    /* test the 80 card game replays with its fourth copies */
+    const gchar* n16[] = { "tony", "paulie", "silvio", "christopher" };
+    struct pinochle* p16 = pinochle_new(4, 4, n16, 16);
+    struct pinochle* p17 = pinochle_new(4, 4, n16, 0);
+    replay_play_bots(p16);
+    struct replay* r16 = replay_new(p16);
+    assert(r16->ntricks == 20);
+    for (guint32 t = 0; t < r16->ntricks; t++) {
+        assert(replay_seek_trick(r16, p17, t) == 1);
+        guint32 held17 = 0;
+        for (guint32 seat = 0; seat < 4; seat++) {
+            held17 += card_list_count(&p17->hands[seat]);
+        }
+        assert(held17 == 80 - 4 * t);
+    }
+    replay_free(r16);
+    pinochle_free(p17);
+    pinochle_free(p16);
+
+    /* test the end of the replay is the end of the game */
+    replay_seek(r11, p12, r11->nactions);
+    for (guint32 seat = 0; seat < 2; seat++) {
+        assert(pinochle_player(p12, seat)->points ==
+               pinochle_player(p11, seat)->points);
+    }
+
+    /* test seek_trick() lands on a fresh trick, and play goes on from it */
+    assert(replay_seek_trick(r11, p12, 5) == 1);
+    assert(p12->ntricks == 5 && p12->trick.ncards == 0);
+    while (pinochle_is_over(p12) == 0) {
+        struct card_set legal = pinochle_legal_plays(p12);
+        pinochle_play_slot(p12, (guint8)bit_first(card_set_presence(legal)));
+    }
+    assert(p12->nactions == r11->nactions);
+    assert(replay_seek_trick(r11, p12, 12) == 0);
+
+    replay_free(r11);
+    pinochle_free(p13);
+    pinochle_free(p12);
+    pinochle_free(p11);
+
+    printf("[+] Finished tests for replay.\n");
+}
+/* ***** */
+
+/* *** view *** */
+/* publishes read-only copies of a game for other threads. the game's
+ * driver builds a view after each change and swaps it in with one atomic
+ * store. readers load the pointer and copy what they need, without a lock,
+ * so any number of spectators can poll a table and never hold up play.
+ *
+ * a replaced view is freed only once no reader can still hold it. a reader
+ * writes the global epoch to its slot before it loads a view and clears
+ * the slot when done. a replaced view is stamped with the epoch it was
+ * retired in, and the epoch moves on. it is reused once every busy reader
+ * slot shows a later epoch, because those readers loaded the pointer after
+ * the swap. one thread at a time may publish to a cell. */
+#define VIEW_MAX_READERS 256
+
+/* a game as of one version. never written after it is published. */
+struct game_view
+{
+    guint64 version; /* counts publishes to the cell */
+    guint64 seed;
+    guint32 nplayers;
+    guint32 nplays;
+    guint8 plays[PINOCHLE_MAX_PLAYS]; /* slots played, in order */
+    struct pinochle_snapshot state;
+    /* for the publisher only */
+    guintptr retired_at;
+    struct game_view* next;
+};
+
+struct view_cell
+{
+    struct game_view* current; /* read with atomics */
+    guint64 version;
+    struct game_view* retired; /* newest first */
+    struct game_view* spare;
+    guint32 nviews; /* ever allocated, for tests */
+};
+
+/* one per reading thread, on its own cache line. */
+struct view_reader
+{
+    guintptr epoch; /* 0 when not reading */
+    gint used;
+} __attribute__((aligned(64)));
+
+static guintptr view_epoch = 1;
+static struct view_reader view_readers[VIEW_MAX_READERS];
+static __thread struct view_reader* view_self = NULL;
+
+/* claims a reader slot for this thread. returns NULL if all
+ * VIEW_MAX_READERS are taken. */
+struct view_reader*
+view_reader_self()
+{
+    if (view_self == NULL) {
+        for (guint32 i = 0; i < VIEW_MAX_READERS; i++) {
+            struct view_reader* r = &view_readers[i];
+            if (g_atomic_int_compare_and_exchange(&r->used, 0, 1)) {
+                view_self = r;
+                break;
+            }
+        }
+    }
+
+    return view_self;
+}
+
+/* gives the slot back when a reading thread is done with views. */
+void
+view_reader_release()
+{
+    if (view_self != NULL) {
+        g_atomic_pointer_set(&view_self->epoch, 0);
+        g_atomic_int_set(&view_self->used, 0);
+        view_self = NULL;
+    }
+}
+
+/* the oldest epoch a reader is in, or the current one if none are. */
+guintptr
+view_min_epoch()
+{
+    guintptr min = g_atomic_pointer_get(&view_epoch);
+    for (guint32 i = 0; i < VIEW_MAX_READERS; i++) {
+        guintptr e = g_atomic_pointer_get(&view_readers[i].epoch);
+        if (e != 0 && e < min) {
+            min = e;
+        }
+    }
+
+    return min;
+}
+
+void
+view_cell_init(struct view_cell* c)
+{
+    memset(c, 0, sizeof(*c));
+}
+
+/* moves retired views no reader can hold to the spare list. */
+void
+view_reclaim(struct view_cell* c)
+{
+    guintptr min = view_min_epoch();
+    struct game_view** link = &c->retired;
+    while (*link != NULL) {
+        struct game_view* v = *link;
+        if (v->retired_at < min) {
+            *link = v->next;
+            v->next = c->spare;
+            c->spare = v;
+        } else {
+            link = &v->next;
+        }
+    }
+}
+
+/* swaps v in as the current view (NULL for none) and retires the old one. */
+void
+view_swap(struct view_cell* c, struct game_view* v)
+{
+    struct game_view* old = c->current;
+    g_atomic_pointer_set(&c->current, v);
+    if (old != NULL) {
+        old->retired_at = g_atomic_pointer_add(&view_epoch, 1);
+        old->next = c->retired;
+        c->retired = old;
+    }
+    view_reclaim(c);
+}
+
+/* publishes the game as it is now. */
+void
+view_publish(struct view_cell* c, struct pinochle* p)
+{
+    struct game_view* v = c->spare;
+    if (v != NULL) {
+        c->spare = v->next;
+    } else {
+        v = malloc(sizeof(struct game_view));
+        c->nviews++;
+    }
+    v->version = ++c->version;
+    v->seed = p->seed;
+    v->nplayers = p->nplayers;
+    v->nplays = 0;
+    for (guint32 i = 0; i < p->nactions; i++) {
+        if (p->actions[i].kind == action_play &&
+            v->nplays < PINOCHLE_MAX_PLAYS) {
+            v->plays[v->nplays++] = (guint8)p->actions[i].value;
+        }
+    }
+    pinochle_snapshot_take(p, &v->state);
+    view_swap(c, v);
+}
+
+/* withdraws the current view, such as when the game goes away. */
+void
+view_unpublish(struct view_cell* c)
+{
+    view_swap(c, NULL);
+}
+
+/* starts a read of the cell's current view, which may be NULL. the view
+ * stays valid until view_read_end(). reads do not nest. it is NULL too if
+ * the thread has no reader slot, which view_reader_self() tells apart. */
+const struct game_view*
+view_read_begin(struct view_cell* c)
+{
+    struct view_reader* r = view_reader_self();
+    if (r == NULL) {
+        return NULL;
+    }
+    g_atomic_pointer_set(&r->epoch, g_atomic_pointer_get(&view_epoch));
+
+    return g_atomic_pointer_get(&c->current);
+}
+
+void
+view_read_end()
+{
+    if (view_self != NULL) {
+        g_atomic_pointer_set(&view_self->epoch, 0);
+    }
+}
+
+/* waits until every read that started before now has ended. */
+void
+view_synchronize()
+{
+    guintptr target = g_atomic_pointer_add(&view_epoch, 1) + 1;
+    while (view_min_epoch() < target) {
+        g_thread_yield();
+    }
+}
+
+void
+view_free_list(struct game_view* v)
+{
+    while (v != NULL) {
+        struct game_view* next = v->next;
+        free(v);
+        v = next;
+    }
+}
+
+/* frees every view of the cell, waiting out readers still holding one. */
+void
+view_cell_clear(struct view_cell* c)
+{
+    view_unpublish(c);
+    view_synchronize();
+    view_free_list(c->retired);
+    view_free_list(c->spare);
+    view_cell_init(c);
+}
+
+struct view_test
+{
+    struct view_cell* cell;
+    gint done;
+    guint32 nreads;
+};
+
+/* checks every view it reads adds up, and that versions never go back. */
+gpointer
+view_test_reader(gpointer data)
+{
+    struct view_test* t = data;
+    guint64 last = 0;
+    while (g_atomic_int_get(&t->done) == 0) {
+        const struct game_view* v = view_read_begin(t->cell);
+        if (v != NULL) {
+            assert(v->version >= last);
+            last = v->version;
+            struct card_set stock = { v->state.stock };
+            guint32 ncards = card_set_count(stock);
+            for (guint32 seat = 0; seat < v->nplayers; seat++) {
+                struct card_set hand = { v->state.hands[seat] };
+                ncards += card_set_count(hand);
+            }
+            assert(ncards + v->nplays == 48);
+            assert(v->nplays == v->state.ntricks * v->nplayers +
+                                  v->state.trick.ncards);
+        }
+        view_read_end();
+        t->nreads++;
+    }
+    view_reader_release();
+
+    return NULL;
+}
+
+void
+view_tests()
+{
+    printf("[+] Running tests for view.\n");
+
+    /* test publish() shows the game as it was */
+    const gchar* n11[] = { "paulie walnuts", "silvio dante" };
+    struct pinochle* p11 = pinochle_new(2, 2, n11, 11);
+    struct view_cell c11;
+    view_cell_init(&c11);
+    assert(view_read_begin(&c11) == NULL);
+    view_read_end();
+    pinochle_deal_init(p11);
+    view_publish(&c11, p11);
+    const struct game_view* v11 = view_read_begin(&c11);
+    assert(v11->version == 1 && v11->nplays == 0 && v11->seed == 11);
+    assert(v11->state.hands[0] == p11->hands[0].cards.bits);
+    view_read_end();
+    pinochle_play_begin(p11, spades);
+    struct card_set legal11 = pinochle_legal_plays(p11);
+    guint8 slot11 = (guint8)bit_first(card_set_presence(legal11));
+    pinochle_play_slot(p11, slot11);
+    view_publish(&c11, p11);
+    v11 = view_read_begin(&c11);
+    assert(v11->version == 2 && v11->nplays == 1 && v11->plays[0] == slot11);
+    view_read_end();
+
+    /* test a view held by a reader is not reused until it lets go */
+    const struct game_view* v12 = view_read_begin(&c11);
+    for (guint32 i = 0; i < 10; i++) {
+        view_publish(&c11, p11);
+    }
+    assert(v12->version == 2 && c11.nviews >= 3);
+    view_read_end();
+    /* the retired views come back once the next publish reclaims them */
+    view_publish(&c11, p11);
+    guint32 nviews12 = c11.nviews;
+    for (guint32 i = 0; i < 10; i++) {
+        view_publish(&c11, p11);
+    }
+    assert(c11.nviews == nviews12);
+
+    /* test a thread gets no view, rather than a shared slot, once every
+     * reader slot is taken */
+    view_reader_release();
+    guint8 taken13[VIEW_MAX_READERS];
+    for (guint32 i = 0; i < VIEW_MAX_READERS; i++) {
+        taken13[i] = g_atomic_int_compare_and_exchange(
+          &view_readers[i].used, 0, 1);
+    }
+    assert(view_reader_self() == NULL);
+    assert(view_read_begin(&c11) == NULL);
+    view_read_end();
+    for (guint32 i = 0; i < VIEW_MAX_READERS; i++) {
+        if (taken13[i]) {
+            g_atomic_int_set(&view_readers[i].used, 0);
+        }
+    }
+    assert(view_reader_self() != NULL);
+    assert(view_read_begin(&c11) != NULL);
+    view_read_end();
+    view_unpublish(&c11);
+    assert(view_read_begin(&c11) == NULL);
+    view_read_end();
+    view_cell_clear(&c11);
+    pinochle_free(p11);
+
+    /* test readers on other threads while games are played and published */
+    struct view_cell c21;
+    view_cell_init(&c21);
+    struct view_test t21 = { &c21, 0, 0 };
+    struct view_test r21[3];
+    GThread* th21[3];
+    for (guint32 i = 0; i < 3; i++) {
+        r21[i] = t21;
+        th21[i] = g_thread_new("view", view_test_reader, &r21[i]);
+    }
+    struct pinochle* p21 = pinochle_new(2, 2, n11, 21);
+    for (guint64 seed = 0; seed < 200; seed++) {
+        pinochle_reset(p21, seed);
+        pinochle_deal_init(p21);
+        pinochle_play_begin(p21, (enum suit)(seed % NSUIT));
+        view_publish(&c21, p21);
+        while (pinochle_is_over(p21) == 0) {
+            struct card_set legal = pinochle_legal_plays(p21);
+            pinochle_play_slot(p21,
+                               (guint8)bit_first(card_set_presence(legal)));
+            view_publish(&c21, p21);
+        }
+    }
+    for (guint32 i = 0; i < 3; i++) {
+        g_atomic_int_set(&r21[i].done, 1);
+        g_thread_join(th21[i]);
+    }
+    assert(c21.version == 200 * 25);
+    /* with the readers gone every retired view is reclaimed */
+    view_publish(&c21, p21);
+    assert(c21.retired == NULL && c21.spare != NULL);
+    view_cell_clear(&c21);
+    pinochle_free(p21);
+
+    /* test a view keeps every play of the 80 card game */
+    const gchar* n31[] = { "tony", "paulie", "silvio", "christopher" };
+    struct pinochle* p31 = pinochle_new(4, 4, n31, 31);
+    replay_play_bots(p31);
+    struct view_cell c31;
+    view_cell_init(&c31);
+    view_publish(&c31, p31);
+    const struct game_view* v31 = view_read_begin(&c31);
+    assert(v31->nplays == 80 && v31->state.ntricks == 20);
+    assert(v31->plays[79] == p31->actions[p31->nactions - 1].value);
+    view_read_end();
+    view_cell_clear(&c31);
+    pinochle_free(p31);
+
+    printf("[+] Finished tests for view.\n");
+}
+/* ***** */
+
+/* *** record *** */
+/* fixed-size binary records of deals and played games. a file is a
+ * struct record_header followed by records of one kind, written in the
+ * host's byte order, which the header's byte_order field records. a
+ * record_writer streams them through a stdio buffer and a record_reader
+ * maps the file and hands out pointers into it, so scanning a file
+ * allocates nothing per record. */
+#define RECORD_MAGIC "PNCL"
+#define RECORD_VERSION 3
+/* bids and passes a game record keeps, and the cards it can bury: the
+ * three-handed widow. */
+#define RECORD_MAX_BIDS 64
+#define RECORD_MAX_BURIED 3
+#define RECORD_BYTE_ORDER 0x01020304u
+
+enum record_kind
+{
+    record_kind_deal = 1,
+    record_kind_game = 2
+};
+
+struct record_header
+{
+    gchar magic[4];
+    guint16 version;
+    guint16 kind;
+    guint32 record_size;
+    guint32 byte_order;
+};
+
+/* a deal: the hands as card_set bits by seat, and the cards left over. */
+struct record_deal
+{
+    guint64 seed;
+    guint64 hands[4];
+    guint64 stock;
+    guint8 dealer;
+    guint8 nplayers;
+    guint8 ndecks;
+    guint8 pad[5];
+};
+
+/* a played game: its deal, the auction, the cards the high bidder
+ * buried and every card played, as card slots, in order. */
+struct record_game
+{
+    struct record_deal deal;
+    guint16 points[4];
+    guint16 high_bid;
+    guint8 high_bidder;
+    guint8 trump;
+    guint8 nplays;
+    guint8 nbids;
+    guint8 nburied;
+    guint8 buried[RECORD_MAX_BURIED];
+    guint8 pad[6];
+    /* every bid in turn from the seat left of the dealer, 0 for a pass */
+    guint16 bids[RECORD_MAX_BIDS];
+    guint8 plays[PINOCHLE_MAX_PLAYS];
+};
+
+G_STATIC_ASSERT(sizeof(struct record_header) == 16);
+G_STATIC_ASSERT(sizeof(struct record_deal) == 56);
+G_STATIC_ASSERT(sizeof(struct record_game) ==
+                80 + 2 * RECORD_MAX_BIDS + PINOCHLE_MAX_PLAYS);
+
+gsize
+record_size(enum record_kind kind)
+{
+    return kind == record_kind_deal ? sizeof(struct record_deal)
+                                    : sizeof(struct record_game);
+}
+
+void
+record_deal_from_game(struct pinochle* p, struct record_deal* out)
+{
+    memset(out, 0, sizeof(*out));
+    out->seed = p->seed;
+    for (guint32 seat = 0; seat < p->nplayers; seat++) {
+        out->hands[seat] = p->hands[seat].cards.bits;
+    }
+    out->stock = p->deck->cards.bits;
+    out->dealer = (guint8)pinochle_dealer_seat(p);
+    out->nplayers = (guint8)p->nplayers;
+    out->ndecks = (guint8)p->deck->ndecks;
+}
+
+/* a played game. deal is the record of the same game taken after the deal
+ * and before the first play, since the hands shrink as cards are played.
+ * returns 1 on success and 0 if the auction ran past RECORD_MAX_BIDS. */
+unsigned int
+record_game_from_game(struct pinochle* p,
+                      const struct record_deal* deal,
+                      struct record_game* out)
+{
+    memset(out, 0, sizeof(*out));
+    out->deal = *deal;
+    for (guint32 seat = 0; seat < p->nplayers; seat++) {
+        out->points[seat] = (guint16)p->players[seat].points;
+    }
+    out->high_bid = (guint16)(p->auction.done ? p->auction.high_bid : 0);
+    out->high_bidder =
+      (guint8)(p->auction.done ? p->auction.high_bidder : G_MAXUINT8);
+    out->trump = (guint8)p->trump;
+    for (guint32 i = 0; i < p->nactions; i++) {
+        const struct action* a = &p->actions[i];
+        if (a->kind == action_bid || a->kind == action_pass) {
+            if (out->nbids == RECORD_MAX_BIDS) {
+                printf("ERROR: An auction of more than %u bids cannot be "
+                       "recorded.\n",
+                       RECORD_MAX_BIDS);
+
+                return 0;
+            }
+            out->bids[out->nbids++] =
+              (guint16)(a->kind == action_bid ? a->value : 0);
+        } else if (a->kind == action_bury && out->nburied < RECORD_MAX_BURIED) {
+            out->buried[out->nburied++] = (guint8)a->value;
+        } else if (a->kind == action_play && out->nplays < PINOCHLE_MAX_PLAYS) {
+            out->plays[out->nplays++] = (guint8)a->value;
+        }
+    }
+
+    return 1;
+}
+
+/* puts the game back to the recorded deal: same seed, dealer, hands and
+ * stock, with no cards played. */
+void
+record_deal_restore(const struct record_deal* deal, struct pinochle* p)
+{
+    pinochle_reset(p, deal->seed);
+    for (guint32 seat = 0; seat < p->nplayers; seat++) {
+        p->hands[seat].cards.bits = deal->hands[seat];
+    }
+    pinochle_set_dealer(p, deal->dealer);
+    p->deck->cards.bits = deal->stock;
+}
+
+struct record_writer
+{
+    FILE* f;
+    enum record_kind kind;
+    guint64 count;
+};
+
+#define RECORD_WRITER_BUFFER (1 << 20)
+
+/* creates path and writes its header. returns NULL on error. */
+struct record_writer*
+record_writer_open(const char* path, enum record_kind kind)
+{
+    FILE* f = fopen(path, "wb");
+    if (f == NULL) {
+        printf("ERROR: Cannot open %s for writing.\n", path);
+
+        return NULL;
+    }
+    setvbuf(f, NULL, _IOFBF, RECORD_WRITER_BUFFER);
+    struct record_header h;
+    memcpy(h.magic, RECORD_MAGIC, sizeof(h.magic));
+    h.version = RECORD_VERSION;
+    h.kind = (guint16)kind;
+    h.record_size = (guint32)record_size(kind);
+    h.byte_order = RECORD_BYTE_ORDER;
+    if (fwrite(&h, sizeof(h), 1, f) != 1) {
+        fclose(f);
+
+        return NULL;
+    }
+    struct record_writer* w = malloc(sizeof(struct record_writer));
+    w->f = f;
+    w->kind = kind;
+    w->count = 0;
+
+    return w;
+}
+
+/* appends one record, a struct record_deal or struct record_game to match
+ * the writer. returns 1 on success and 0 on error. */
+unsigned int
+record_writer_put(struct record_writer* w, const void* record)
+{
+    if (fwrite(record, record_size(w->kind), 1, w->f) != 1) {
+        return 0;
+    }
+    w->count++;
+
+    return 1;
+}
+
+/* flushes and closes the file. returns 1 if every record was written. */
+unsigned int
+record_writer_close(struct record_writer* w)
+{
+    unsigned int ok = fclose(w->f) == 0;
+    free(w);
+
+    return ok;
+}
+
+struct record_reader
+{
+    void* map;
+    gsize map_size;
+    enum record_kind kind;
+    guint64 count;
+    const guint8* records;
+};
+
+/* maps path for reading. returns NULL if it cannot be read or is not a
+ * record file written on a host of the same byte order. a partly written
+ * last record is ignored. */
+struct record_reader*
+record_reader_open(const char* path)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        printf("ERROR: Cannot open %s for reading.\n", path);
+
+        return NULL;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 ||
+        (gsize)st.st_size < sizeof(struct record_header)) {
+        close(fd);
+
+        return NULL;
+    }
+    void* map = mmap(NULL, (gsize)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        return NULL;
+    }
+    const struct record_header* h = map;
+    if (memcmp(h->magic, RECORD_MAGIC, sizeof(h->magic)) != 0 ||
+        h->version != RECORD_VERSION || h->byte_order != RECORD_BYTE_ORDER ||
+        (h->kind != record_kind_deal && h->kind != record_kind_game) ||
+        h->record_size != record_size(h->kind)) {
+        printf("ERROR: %s is not a record file this build can read.\n", path);
+        munmap(map, (gsize)st.st_size);
+
+        return NULL;
+    }
+    madvise(map, (gsize)st.st_size, MADV_SEQUENTIAL);
+
+    struct record_reader* r = malloc(sizeof(struct record_reader));
+    r->map = map;
+    r->map_size = (gsize)st.st_size;
+    r->kind = h->kind;
+    r->count = (r->map_size - sizeof(struct record_header)) / h->record_size;
+    r->records = (const guint8*)map + sizeof(struct record_header);
+
+    return r;
+}
+
+/* whether a deal's counts can index the seats and hands it has, since
+ * the file may come from anywhere. a record keeps one card_set per hand,
+ * so it cannot hold the 80 card game. */
+unsigned int
+record_deal_valid(const struct record_deal* d)
+{
+    return d->nplayers > 0 && d->nplayers <= PINOCHLE_MAX_SEATS &&
+           d->dealer < d->nplayers && d->ndecks <= CARD_SET_MAX_COPIES;
+}
+
+/* the i-th record of a deal file, pointing into the mapping. NULL past
+ * the end or if the record is damaged. */
+const struct record_deal*
+record_reader_deal(struct record_reader* r, guint64 i)
+{
+    if (r->kind != record_kind_deal || i >= r->count) {
+        return NULL;
+    }
+    const struct record_deal* d =
+      (const struct record_deal*)(r->records + i * sizeof(struct record_deal));
+
+    return record_deal_valid(d) ? d : NULL;
+}
+
+/* the i-th record of a game file, pointing into the mapping. NULL past
+ * the end or if the record is damaged. */
+const struct record_game*
+record_reader_game(struct record_reader* r, guint64 i)
+{
+    if (r->kind != record_kind_game || i >= r->count) {
+        return NULL;
+    }
+    const struct record_game* g =
+      (const struct record_game*)(r->records + i * sizeof(struct record_game));
+    if (record_deal_valid(&g->deal) == 0 || g->nplays > PINOCHLE_MAX_PLAYS ||
+        g->nbids > RECORD_MAX_BIDS || g->nburied > RECORD_MAX_BURIED ||
+        g->trump >= NSUIT) {
+        return NULL;
+    }
+
+    return g;
+}
+
+void
+record_reader_close(struct record_reader* r)
+{
+    munmap(r->map, r->map_size);
+    free(r);
+}
+
+/* console record <path> <ndeals> [seed] */
+int
+record_main(int argc, char** argv)
+{
+    if (argc < 4) {
+        printf("usage: %s record <path> <ndeals> [seed]\n", argv[0]);
+
+        return 1;
+    }
+    guint64 ndeals = g_ascii_strtoull(argv[3], NULL, 10);
+    guint64 seed = argc > 4 ? g_ascii_strtoull(argv[4], NULL, 10) : 1;
+    struct record_writer* w = record_writer_open(argv[2], record_kind_deal);
+    if (w == NULL) {
+        return 1;
+    }
+    const gchar* names[] = { "north", "east", "south", "west" };
+    struct pinochle* p = pinochle_new(NPLAYERS, NDECKS, names, seed);
+    struct record_deal rec;
+    for (guint64 i = 0; i < ndeals; i++) {
+        pinochle_reset(p, seed + i);
+        pinochle_deal_init(p);
+        record_deal_from_game(p, &rec);
+        if (record_writer_put(w, &rec) == 0) {
+            printf("ERROR: Cannot write to %s.\n", argv[2]);
+            break;
+        }
+    }
+    pinochle_free(p);
+    guint32 ok = w->count == ndeals;
+
+    return record_writer_close(w) && ok ? 0 : 1;
+}
+
+/* console scan <path> */
+int
+record_scan_main(int argc, char** argv)
+{
+    if (argc < 3) {
+        printf("usage: %s scan <path>\n", argv[0]);
+
+        return 1;
+    }
+    struct record_reader* r = record_reader_open(argv[2]);
+    if (r == NULL) {
+        return 1;
+    }
+    guint64 nhands = 0;
+    guint64 counters = 0;
+    for (guint64 i = 0; i < r->count; i++) {
+        const struct record_deal* d = NULL;
+        if (r->kind == record_kind_deal) {
+            d = record_reader_deal(r, i);
+        } else if (record_reader_game(r, i) != NULL) {
+            d = &record_reader_game(r, i)->deal;
+        }
+        if (d == NULL) {
+            printf("ERROR: Record %" G_GUINT64_FORMAT " of %s is damaged.\n",
+                   i,
+                   argv[2]);
+            record_reader_close(r);
+
+            return 1;
+        }
+        for (guint32 seat = 0; seat < d->nplayers; seat++) {
+            struct card_set hand = { d->hands[seat] };
+            counters += card_set_count_counters(hand);
+            nhands++;
+        }
+    }
+    printf("records,%" G_GUINT64_FORMAT "\n", r->count);
+    printf("mean_counters,%.3f\n",
+           nhands > 0 ? (double)counters / nhands : 0.0);
+    record_reader_close(r);
+
+    return 0;
+}
+
+void
+record_tests()
+{
+    printf("[+] Running tests for record.\n");
+
+    gchar path[] = "/tmp/pinochle-record-XXXXXX";
+    int fd = mkstemp(path);
+    assert(fd >= 0);
+    close(fd);
+
+    /* test deals round trip through a file */
+    const gchar* n11[] = { "paulie walnuts", "silvio dante" };
+    struct pinochle* p11 = pinochle_new(2, 2, n11, 11);
+    struct record_writer* w11 = record_writer_open(path, record_kind_deal);
+    assert(w11 != NULL);
+    struct record_deal d11[5];
+    for (guint32 i = 0; i < 5; i++) {
+        pinochle_reset(p11, 11 + i);
+        pinochle_deal_init(p11);
+        record_deal_from_game(p11, &d11[i]);
+        assert(record_writer_put(w11, &d11[i]) == 1);
+    }
+    assert(record_writer_close(w11) == 1);
+    struct record_reader* r11 = record_reader_open(path);
+    assert(r11 != NULL && r11->kind == record_kind_deal && r11->count == 5);
+    for (guint32 i = 0; i < 5; i++) {
+        assert(memcmp(record_reader_deal(r11, i), &d11[i],
+                      sizeof(struct record_deal)) == 0);
+    }
+    assert(record_reader_deal(r11, 5) == NULL);
+    assert(record_reader_game(r11, 0) == NULL);
+    record_reader_close(r11);
+
+    /* test a record with more seats than a game has is refused */
+    FILE* f12 = fopen(path, "r+b");
+    struct record_deal d13 = d11[1];
+    d13.nplayers = 200;
+    fseek(f12,
+          sizeof(struct record_header) + sizeof(struct record_deal),
+          SEEK_SET);
+    fwrite(&d13, sizeof(d13), 1, f12);
+    fclose(f12);
+    r11 = record_reader_open(path);
+    assert(record_reader_deal(r11, 0) != NULL);
+    assert(record_reader_deal(r11, 1) == NULL);
+
+    /* test restore() puts a game back to its recorded deal */
+    pinochle_reset(p11, 99);
+    record_deal_restore(record_reader_deal(r11, 3), p11);
+    struct record_deal d12;
+    record_deal_from_game(p11, &d12);
+    assert(memcmp(&d12, &d11[3], sizeof(struct record_deal)) == 0);
+    record_reader_close(r11);
+
+    /* test a played game round trips and replays to the same points */
+    struct record_writer* w21 = record_writer_open(path, record_kind_game);
+    pinochle_reset(p11, 21);
+    pinochle_deal_init(p11);
+    struct record_deal d21;
+    record_deal_from_game(p11, &d21);
+    pinochle_play_begin(p11, spades);
+    while (pinochle_is_over(p11) == 0) {
+        struct card_set legal = pinochle_legal_plays(p11);
+        pinochle_play_slot(p11, (guint8)bit_first(card_set_presence(legal)));
+    }
+    struct record_game g21;
+    assert(record_game_from_game(p11, &d21, &g21) == 1);
+    assert(g21.nplays == 24 && g21.nbids == 0 && g21.nburied == 0);
+    record_writer_put(w21, &g21);
+    record_writer_close(w21);
+    struct record_reader* r21 = record_reader_open(path);
+    const struct record_game* g22 = record_reader_game(r21, 0);
+    assert(r21->count == 1 && memcmp(g22, &g21, sizeof(g21)) == 0);
+    record_deal_restore(&g22->deal, p11);
+    pinochle_play_begin(p11, g22->trump);
+    for (guint32 i = 0; i < g22->nplays; i++) {
+        pinochle_play_slot(p11, g22->plays[i]);
+    }
+    for (guint32 seat = 0; seat < 2; seat++) {
+        assert(pinochle_player(p11, seat)->points == g22->points[seat]);
+    }
+    record_reader_close(r21);
+    pinochle_free(p11);
+
+    /* test a three-handed game keeps its bids and burial, and replays
+     * from them to the same points */
+    const gchar* n41[] = { "tony", "paulie", "silvio" };
+    struct pinochle* p41 = pinochle_new(3, 2, n41, 41);
+    pinochle_deal_init(p41);
+    struct record_deal d41;
+    record_deal_from_game(p41, &d41);
+    pinochle_auction_begin(p41);
+    guint32 nbids41 = 0;
+    while (p41->auction.done == 0) {
+        guint32 bid = pinochle_decide_bid(p41);
+        if (bid > 0) {
+            pinochle_bid(p41, bid);
+        } else {
+            pinochle_pass(p41);
+        }
+        nbids41++;
+    }
+    pinochle_declare_best(p41);
+    while (pinochle_is_over(p41) == 0) {
+        struct card_set legal = pinochle_legal_plays(p41);
+        pinochle_play_slot(p41, (guint8)bit_first(card_set_presence(legal)));
+    }
+    struct record_game g41;
+    assert(record_game_from_game(p41, &d41, &g41) == 1);
+    assert(g41.nbids == nbids41 && g41.nburied == 3 && g41.nplays == 45);
+    struct record_writer* w41 = record_writer_open(path, record_kind_game);
+    record_writer_put(w41, &g41);
+    record_writer_close(w41);
+    struct record_reader* r41 = record_reader_open(path);
+    const struct record_game* g42 = record_reader_game(r41, 0);
+    assert(g42 != NULL && memcmp(g42, &g41, sizeof(g41)) == 0);
+    record_deal_restore(&g42->deal, p41);
+    pinochle_auction_begin(p41);
+    for (guint32 i = 0; i < g42->nbids; i++) {
+        assert(g42->bids[i] > 0 ? pinochle_bid(p41, g42->bids[i])
+                                : pinochle_pass(p41));
+    }
+    assert(p41->auction.high_bidder == g42->high_bidder);
+    assert(pinochle_take_widow(p41) == 1);
+    pinochle_play_begin(p41, g42->trump);
+    for (guint32 i = 0; i < g42->nburied; i++) {
+        assert(pinochle_bury_slot(p41, g42->buried[i]) == 1);
+    }
+    for (guint32 i = 0; i < g42->nplays; i++) {
+        pinochle_play_slot(p41, g42->plays[i]);
+    }
+    for (guint32 seat = 0; seat < 3; seat++) {
+        assert(pinochle_player(p41, seat)->points == g42->points[seat]);
+    }
+    record_reader_close(r41);
+
+    /* test an auction too long for a record is refused */
+    record_deal_restore(&d41, p41);
+    pinochle_auction_begin(p41);
+    for (guint32 i = 0; i <= RECORD_MAX_BIDS; i++) {
+        assert(pinochle_bid(p41, MIN_BID + i) == 1);
+    }
+    assert(record_game_from_game(p41, &d41, &g41) == 0);
+    pinochle_free(p41);
+
+    /* test a file that is not a record file is refused */
+    FILE* f31 = fopen(path, "wb");
+    fputs("not a record file at all", f31);
+    fclose(f31);
+    assert(record_reader_open(path) == NULL);
+
+    remove(path);
+
+    printf("[+] Finished tests for record.\n");
+}
+/* ***** */
+
+/* *** memo *** */
+/* a bounded cache of 64-bit results keyed by 64-bit hashes of hands or
+ * positions, shared by threads. it is split into shards by the top bits
+ * of the key, each with its own lock, so threads rarely wait on each
+ * other. a shard is an array of sets of MEMO_WAYS entries, picked by the
+ * low bits of the key. a full set evicts its least recently used entry,
+ * or a random one, which costs nothing to keep up. */
+#define MEMO_WAYS 4
+
+enum memo_policy
+{
+    memo_lru,
+    memo_random
+};
+
+struct memo_entry
+{
+    guint64 key;
+    guint64 value;
+    guint32 stamp; /* shard clock at the last use */
+    guint32 used;
+};
+
+struct memo_stats
+{
+    guint64 hits;
+    guint64 misses;
+    guint64 inserts;
+    guint64 evictions;
+    guint64 capacity;
+};
+
+struct memo_shard
+{
+    GMutex lock;
+    struct memo_entry* entries;
+    guint64 set_mask;
+    guint32 clock;
+    struct memo_stats stats;
+} __attribute__((aligned(64)));
+
+struct memo
+{
+    struct memo_shard* shards;
+    guint32 nshards;
+    guint32 shard_shift;
+    enum memo_policy policy;
+};
+
+/* splitmix64's finalizer: spreads the bits of x over the whole word. */
+guint64
+memo_mix(guint64 x)
+{
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+
+    return x;
+}
+
+/* a key for a per-hand result, such as a meld or bid value. */
+guint64
+memo_key_hand(struct card_set hand, enum suit trump)
+{
+    return memo_mix(hand.bits ^ ((guint64)trump << 62));
+}
+
+/* a cache in about memory_bytes, in nshards shards (rounded down to a
+ * power of two). */
+struct memo*
+memo_new(gsize memory_bytes, guint32 nshards, enum memo_policy policy)
+{
+    struct memo* m = malloc(sizeof(struct memo));
+    m->nshards = 1;
+    m->shard_shift = 64;
+    while (m->nshards * 2 <= nshards) {
+        m->nshards *= 2;
+        m->shard_shift--;
+    }
+    m->policy = policy;
+    gsize set_bytes = MEMO_WAYS * sizeof(struct memo_entry);
+    guint64 nsets = 1;
+    while ((nsets * 2) * set_bytes * m->nshards <= memory_bytes) {
+        nsets *= 2;
+    }
+    m->shards = aligned_alloc(64, m->nshards * sizeof(struct memo_shard));
+    for (guint32 i = 0; i < m->nshards; i++) {
+        struct memo_shard* s = &m->shards[i];
+        g_mutex_init(&s->lock);
+        s->entries = calloc(nsets * MEMO_WAYS, sizeof(struct memo_entry));
+        s->set_mask = nsets - 1;
+        s->clock = 0;
+        memset(&s->stats, 0, sizeof(s->stats));
+        s->stats.capacity = nsets * MEMO_WAYS;
+    }
+
+    return m;
+}
+
+void
+memo_free(struct memo* m)
+{
+    for (guint32 i = 0; i < m->nshards; i++) {
+        free(m->shards[i].entries);
+        g_mutex_clear(&m->shards[i].lock);
+    }
+    free(m->shards);
+    free(m);
+}
+
+struct memo_shard*
+memo_shard(struct memo* m, guint64 key)
+{
+    return &m->shards[m->shard_shift == 64 ? 0 : key >> m->shard_shift];
+}
+
+/* looks key up. returns 1 and sets value on a hit, 0 on a miss. */
+unsigned int
+memo_get(struct memo* m, guint64 key, guint64* value)
+{
+    struct memo_shard* s = memo_shard(m, key);
+    g_mutex_lock(&s->lock);
+    struct memo_entry* set = &s->entries[(key & s->set_mask) * MEMO_WAYS];
+    unsigned int hit = 0;
+    for (guint32 i = 0; i < MEMO_WAYS; i++) {
+        if (set[i].used && set[i].key == key) {
+            set[i].stamp = ++s->clock;
+            *value = set[i].value;
+            hit = 1;
+            break;
+        }
+    }
+    if (hit) {
+        s->stats.hits++;
+    } else {
+        s->stats.misses++;
+    }
+    g_mutex_unlock(&s->lock);
+
+    return hit;
+}
+
+/* stores value for key, replacing an older value or evicting an entry of
+ * a full set. */
+void
+memo_put(struct memo* m, guint64 key, guint64 value)
+{
+    struct memo_shard* s = memo_shard(m, key);
+    g_mutex_lock(&s->lock);
+    struct memo_entry* set = &s->entries[(key & s->set_mask) * MEMO_WAYS];
+    struct memo_entry* slot = NULL;
+    for (guint32 i = 0; i < MEMO_WAYS && slot == NULL; i++) {
+        if (set[i].used && set[i].key == key) {
+            slot = &set[i];
+        }
+    }
+    for (guint32 i = 0; i < MEMO_WAYS && slot == NULL; i++) {
+        if (set[i].used == 0) {
+            slot = &set[i];
+        }
+    }
+    if (slot == NULL) {
+        if (m->policy == memo_lru) {
+            slot = &set[0];
+            for (guint32 i = 1; i < MEMO_WAYS; i++) {
+                /* oldest by distance from the clock, so wrapping is fine */
+                if (s->clock - set[i].stamp > s->clock - slot->stamp) {
+                    slot = &set[i];
+                }
+            }
+        } else {
+            slot = &set[memo_mix(key ^ s->clock) % MEMO_WAYS];
+        }
+        s->stats.evictions++;
+    }
+    if (slot->used == 0 || slot->key != key) {
+        s->stats.inserts++;
+    }
+    slot->key = key;
+    slot->value = value;
+    slot->stamp = ++s->clock;
+    slot->used = 1;
+    g_mutex_unlock(&s->lock);
+}
+
+/* the counts of all shards added up. */
+void
+memo_stats(struct memo* m, struct memo_stats* out)
+{
+    memset(out, 0, sizeof(*out));
+    for (guint32 i = 0; i < m->nshards; i++) {
+        struct memo_shard* s = &m->shards[i];
+        g_mutex_lock(&s->lock);
+        out->hits += s->stats.hits;
+        out->misses += s->stats.misses;
+        out->inserts += s->stats.inserts;
+        out->evictions += s->stats.evictions;
+        out->capacity += s->stats.capacity;
+        g_mutex_unlock(&s->lock);
+    }
+}
+
+void
+memo_stats_show(struct memo_stats* st, FILE* out)
+{
+    guint64 lookups = st->hits + st->misses;
+    fprintf(out,
+            "memo_hits,%" G_GUINT64_FORMAT "\n"
+            "memo_misses,%" G_GUINT64_FORMAT "\n"
+            "memo_hit_rate,%.3f\n"
+            "memo_evictions,%" G_GUINT64_FORMAT "\n",
+            st->hits,
+            st->misses,
+            lookups > 0 ? (double)st->hits / lookups : 0.0,
+            st->evictions);
+}
+
+struct memo_test
+{
+    struct memo* memo;
+    guint32 id;
+};
+
+/* puts and gets its own keys, which must never come back wrong. */
+gpointer
+memo_test_run(gpointer data)
+{
+    struct memo_test* t = data;
+    for (guint64 i = 0; i < 20000; i++) {
+        guint64 key = memo_mix((guint64)t->id << 32 | (i % 5000));
+        guint64 value = 0;
+        if (memo_get(t->memo, key, &value)) {
+            assert(value == ~key);
+        } else {
+            memo_put(t->memo, key, ~key);
+        }
+    }
+
+    return NULL;
+}
+
+void
+memo_tests()
+{
+    printf("[+] Running tests for memo.\n");
+
+    /* test put() and get() */
+    struct memo* m11 = memo_new(1 << 16, 4, memo_lru);
+    guint64 v11 = 0;
+    guint64 k11 = memo_key_hand(card_set_full(1), hearts);
+    assert(k11 != memo_key_hand(card_set_full(1), spades));
+    assert(memo_get(m11, k11, &v11) == 0);
+    memo_put(m11, k11, 42);
+    assert(memo_get(m11, k11, &v11) == 1 && v11 == 42);
+    memo_put(m11, k11, 43);
+    assert(memo_get(m11, k11, &v11) == 1 && v11 == 43);
+    struct memo_stats st11;
+    memo_stats(m11, &st11);
+    assert(st11.hits == 2 && st11.misses == 1 && st11.inserts == 1);
+    assert(st11.capacity * sizeof(struct memo_entry) <= 1 << 16);
+    memo_free(m11);
+
+    /* test a full set evicts its least recently used entry */
+    struct memo* m21 = memo_new(MEMO_WAYS * sizeof(struct memo_entry), 1,
+                                memo_lru);
+    for (guint64 k = 1; k <= MEMO_WAYS; k++) {
+        memo_put(m21, k, k);
+    }
+    assert(memo_get(m21, 1, &v11) == 1);
+    memo_put(m21, 100, 100);
+    assert(memo_get(m21, 2, &v11) == 0);
+    assert(memo_get(m21, 1, &v11) == 1 && memo_get(m21, 100, &v11) == 1);
+    struct memo_stats st21;
+    memo_stats(m21, &st21);
+    assert(st21.evictions == 1 && st21.capacity == MEMO_WAYS);
+    memo_free(m21);
+
+    /* test the cache stays bounded and right under threads */
+    struct memo* m31 = memo_new(1 << 18, 8, memo_random);
+    struct memo_test t31[4];
+    GThread* th31[4];
+    for (guint32 i = 0; i < 4; i++) {
+        t31[i].memo = m31;
+        t31[i].id = i;
+        th31[i] = g_thread_new("memo", memo_test_run, &t31[i]);
+    }
+    for (guint32 i = 0; i < 4; i++) {
+        g_thread_join(th31[i]);
+    }
+    struct memo_stats st31;
+    memo_stats(m31, &st31);
+    assert(st31.hits + st31.misses == 4 * 20000);
+    assert(st31.hits > 0 && st31.inserts - st31.evictions <= st31.capacity);
+    memo_free(m31);
+
+    printf("[+] Finished tests for memo.\n");
+}
+/* ***** */
+
+/* *** solver *** */
+/* double-dummy solver: with every hand known, finds the most counters
+ * (plus the last trick) each side can take from the current position
+ * with best play by everyone. with an even number of players the sides
+ * are the even and the odd seats; with three players seat 0 plays
+ * against the other two.
+ *
+ * it is an alpha-beta search over trick_legal() moves with
+ *
+ *   - equivalent-card pruning: copies of a card are one move (a hand
+ *     is a card_set, so they are one slot), and of cards of the same
+ *     suit and point value that one player holds with no other card
+ *     still out between them only the highest is tried,
+ *   - move ordering: lead high, dump counters on a partner's trick, win
+ *     cheaply or throw the cheapest card against an opponent's,
+ *   - a transposition table of bounds on the points still to come,
+ *     probed at the start of every trick. positions are keyed by zobrist
+ *     hashes of the hands and the leader, kept up to date as cards are
+ *     played. the table size comes from a memory budget. */
+#define DD_NSLOTS (4 * CARD_SET_LANE_BITS / CARD_SET_FIELD_BITS)
+#define DD_MAX_MOVES CARD_SET_NCARDS
+#define DD_UNKNOWN_UPPER 255
+
+struct dd_state
+{
+    struct card_set hands[TRICK_MAX_CARDS];
+    struct trick trick;
+    guint32 nplayers;
+    guint32 leader;
+    enum suit trump;
+};
+
+struct dd_entry
+{
+    guint64 key;
+    guint32 generation;
+    guint8 lower;
+    guint8 upper;
+};
+
+struct dd_solver
+{
+    struct dd_entry* table;
+    guint64 mask;
+    guint32 generation;
+    guint64 nodes;
+    guint64 zobrist[TRICK_MAX_CARDS][DD_NSLOTS][CARD_SET_MAX_COPIES];
+    guint64 zobrist_leader[TRICK_MAX_CARDS];
+};
+
+/* a solver whose transposition table fits in memory_bytes. */
+struct dd_solver*
+dd_solver_new(gsize memory_bytes)
+{
+    struct dd_solver* dd = malloc(sizeof(struct dd_solver));
+    guint64 nentries = 1;
+    while (nentries * 2 * sizeof(struct dd_entry) <= memory_bytes) {
+        nentries *= 2;
+    }
+    dd->table = calloc(nentries, sizeof(struct dd_entry));
+    dd->mask = nentries - 1;
+    dd->generation = 0;
+    dd->nodes = 0;
+
+    struct rng r;
+    rng_seed(&r, 0x5eed);
+    for (guint32 i = 0; i < TRICK_MAX_CARDS; i++) {
+        for (guint32 j = 0; j < DD_NSLOTS; j++) {
+            for (guint32 k = 0; k < CARD_SET_MAX_COPIES; k++) {
+                dd->zobrist[i][j][k] = rng_next(&r);
+            }
+        }
+        dd->zobrist_leader[i] = rng_next(&r);
+    }
+
+    return dd;
+}
+
+void
+dd_solver_free(struct dd_solver* dd)
+{
+    free(dd->table);
+    free(dd);
+}
+
+guint32
+dd_team(guint32 seat, guint32 nplayers)
+{
+    if (nplayers % 2 == 0) {
+        return seat % 2;
+    } else {
+        return seat == 0 ? 0 : 1;
+    }
+}
+
+guint64
+dd_hash(struct dd_solver* dd, struct dd_state* s)
+{
+    guint64 key = 0;
+    for (guint32 seat = 0; seat < s->nplayers; seat++) {
+        guint64 bits = s->hands[seat].bits;
+        for (guint32 slot = 0; slot < DD_NSLOTS; slot++) {
+            guint32 cnt = (bits >> (slot * CARD_SET_FIELD_BITS)) &
+                          CARD_SET_FIELD_MASK;
+            for (guint32 k = 0; k < cnt; k++) {
+                key ^= dd->zobrist[seat][slot][k];
+            }
+        }
+    }
+
+    return key;
+}
+
+guint32
+dd_counters_out(struct dd_state* s)
+{
+    guint32 total = s->trick.counters;
+    for (guint32 seat = 0; seat < s->nplayers; seat++) {
+        total += card_set_count_counters(s->hands[seat]);
+    }
+
+    return total;
+}
+
+/* the distinct, non-equivalent legal moves of seat, best first. */
+guint32
+dd_moves(struct dd_state* s, guint32 seat, guint8* moves)
+{
+    struct card_set hand = s->hands[seat];
+    struct card_set legal = trick_legal(&s->trick, hand, s->trump);
+    guint64 cand = card_set_presence(legal);
+
+    /* every card not yet in a finished trick */
+    struct card_set out = card_set_empty();
+    for (guint32 i = 0; i < s->nplayers; i++) {
+        out = card_set_merge(out, s->hands[i]);
+    }
+    guint64 out_present = card_set_presence(out);
+    for (guint32 i = 0; i < s->trick.ncards; i++) {
+        out_present |= 1ULL << s->trick.slots[i];
+    }
+    /* cards all of whose copies still out are in this hand */
+    guint64 diff = hand.bits ^ out.bits;
+    guint64 mine = ~(diff | (diff >> 1)) & card_set_presence(hand);
+    for (guint32 i = 0; i < s->trick.ncards; i++) {
+        mine &= ~(1ULL << s->trick.slots[i]);
+    }
+
+    guint32 n = 0;
+    gint32 scores[DD_MAX_MOVES];
+    guint32 winning_team = 0;
+    guint64 beat = 0;
+    if (s->trick.ncards > 0) {
+        guint32 winner = (s->leader + s->trick.winner) % s->nplayers;
+        winning_team = dd_team(winner, s->nplayers);
+        beat = trick_beat_mask(s->trick.slots[s->trick.winner], s->trump);
+    }
+    guint32 my_team = dd_team(seat, s->nplayers);
+
+    for (guint64 c = cand; c != 0; c &= c - 1) {
+        guint32 slot = bit_first(c);
+        guint64 lane_higher = ((1ULL << slot) - 1) &
+                              trick_lane_mask(card_slot_suit((guint8)slot));
+        guint64 higher = out_present & lane_higher;
+        if (higher != 0 && ((mine >> slot) & 1)) {
+            guint32 h = 63 - (guint32)__builtin_clzll(higher);
+            if (((mine >> h) & 1) && ((cand >> h) & 1) &&
+                ((CARD_SET_COUNTER_BITS >> h) & 1) ==
+                  ((CARD_SET_COUNTER_BITS >> slot) & 1)) {
+                continue;
+            }
+        }
+
+        gint32 rank = (gint32)card_slot_rank((guint8)slot);
+        gint32 counter = (gint32)((CARD_SET_COUNTER_BITS >> slot) & 1);
+        gint32 score;
+        if (s->trick.ncards == 0) {
+            score = 10 - rank;
+        } else if (winning_team == my_team) {
+            score = 10 * counter + rank;
+        } else if ((beat >> slot) & 1) {
+            score = 20 + rank;
+        } else {
+            score = 10 * (1 - counter) + rank;
+        }
+
+        guint32 i = n++;
+        while (i > 0 && scores[i - 1] < score) {
+            moves[i] = moves[i - 1];
+            scores[i] = scores[i - 1];
+            i--;
+        }
+        moves[i] = (guint8)slot;
+        scores[i] = score;
+    }
+
+    return n;
+}
+
+gint32
+dd_search(struct dd_solver* dd,
+          struct dd_state* s,
+          guint64 key,
+          gint32 alpha,
+          gint32 beta)
+{
+    dd->nodes++;
+    struct dd_entry* e = NULL;
+    guint64 tt_key = 0;
+    if (s->trick.ncards == 0) {
+        if (s->hands[s->leader].bits == 0) {
+            return 0;
+        }
+        tt_key = key ^ dd->zobrist_leader[s->leader];
+        e = &dd->table[tt_key & dd->mask];
+        if (e->key == tt_key && e->generation == dd->generation) {
+            if (e->lower >= beta || e->lower == e->upper) {
+                return e->lower;
+            }
+            if (e->upper <= alpha) {
+                return e->upper;
+            }
+            alpha = e->lower > alpha ? e->lower : alpha;
+            beta = e->upper < beta ? e->upper : beta;
+        }
+    }
+    gint32 alpha0 = alpha;
+    gint32 beta0 = beta;
+
+    guint32 seat = (s->leader + s->trick.ncards) % s->nplayers;
+    guint32 maximize = dd_team(seat, s->nplayers) == 0;
+    guint8 moves[DD_MAX_MOVES];
+    guint32 nmoves = dd_moves(s, seat, moves);
+
+    gint32 best = maximize ? -1 : G_MAXINT32;
+    for (guint32 i = 0; i < nmoves; i++) {
+        guint8 slot = moves[i];
+        struct trick saved = s->trick;
+        guint32 saved_leader = s->leader;
+        guint32 cnt = (s->hands[seat].bits >> slot) & CARD_SET_FIELD_MASK;
+        guint64 child_key =
+          key ^ dd->zobrist[seat][slot / CARD_SET_FIELD_BITS][cnt - 1];
+        card_set_remove_slot(&s->hands[seat], slot);
+        trick_play(&s->trick, slot, s->trump);
+
+        gint32 v;
+        if (s->trick.ncards == s->nplayers) {
+            guint32 winner = (s->leader + s->trick.winner) % s->nplayers;
+            gint32 points = (gint32)s->trick.counters;
+            if (s->hands[seat].bits == 0) {
+                points += (gint32)LAST_TRICK_POINTS;
+            }
+            gint32 gain = dd_team(winner, s->nplayers) == 0 ? points : 0;
+            s->leader = winner;
+            trick_clear(&s->trick);
+            v = gain + dd_search(dd, s, child_key, alpha - gain, beta - gain);
+        } else {
+            v = dd_search(dd, s, child_key, alpha, beta);
+        }
+
+        s->trick = saved;
+        s->leader = saved_leader;
+        card_set_add_slot(&s->hands[seat], slot);
+
+        if (maximize) {
+            best = v > best ? v : best;
+            alpha = best > alpha ? best : alpha;
+        } else {
+            best = v < best ? v : best;
+            beta = best < beta ? best : beta;
+        }
+        if (alpha >= beta) {
+            break;
+        }
+    }
+
+    if (e != NULL) {
+        if (e->key != tt_key || e->generation != dd->generation) {
+            e->key = tt_key;
+            e->generation = dd->generation;
+            e->lower = 0;
+            e->upper = DD_UNKNOWN_UPPER;
+        }
+        if (best > alpha0 && best < beta0) {
+            e->lower = (guint8)best;
+            e->upper = (guint8)best;
+        } else if (best >= beta0) {
+            e->lower = (guint8)(best > e->lower ? best : e->lower);
+        } else {
+            e->upper = (guint8)(best < e->upper ? best : e->upper);
+        }
+    }
+
+    return best;
+}
+
+/* fills points with the most each side (0: even seats, 1: odd seats)
+ * can take from here on. */
+void
+dd_solve(struct dd_solver* dd, struct dd_state* s, guint32* points)
+{
+    dd->generation++;
+    guint32 total = dd_counters_out(s) + LAST_TRICK_POINTS;
+    gint32 v =
+      dd_search(dd, s, dd_hash(dd, s), -1, (gint32)total + 1);
+    points[0] = (guint32)v;
+    points[1] = total - (guint32)v;
+}
+
+void
+dd_state_from_game(struct dd_state* s, struct pinochle* p)
+{
+    s->nplayers = pinochle_nplayers(p);
+    for (guint32 i = 0; i < s->nplayers; i++) {
+        s->hands[i] = p->hands[i].cards;
+    }
+    s->trick = p->trick;
+    s->leader = p->leader;
+    s->trump = p->trump;
+}
+
+/* plain minimax without pruning or a table, to check dd_search(). */
+gint32
+dd_brute(struct dd_state* s)
+{
+    if (s->trick.ncards == 0 && s->hands[s->leader].bits == 0) {
+        return 0;
+    }
+    guint32 seat = (s->leader + s->trick.ncards) % s->nplayers;
+    guint32 maximize = dd_team(seat, s->nplayers) == 0;
+    guint64 legal = card_set_presence(
+      trick_legal(&s->trick, s->hands[seat], s->trump));
+    gint32 best = maximize ? -1 : G_MAXINT32;
+    for (; legal != 0; legal &= legal - 1) {
+        guint8 slot = (guint8)bit_first(legal);
+        struct dd_state child = *s;
+        card_set_remove_slot(&child.hands[seat], slot);
+        trick_play(&child.trick, slot, child.trump);
+        gint32 gain = 0;
+        if (child.trick.ncards == child.nplayers) {
+            guint32 winner =
+              (child.leader + child.trick.winner) % child.nplayers;
+            gint32 points = (gint32)child.trick.counters;
+            if (child.hands[seat].bits == 0) {
+                points += (gint32)LAST_TRICK_POINTS;
+            }
+            gain = dd_team(winner, child.nplayers) == 0 ? points : 0;
+            child.leader = winner;
+            trick_clear(&child.trick);
+        }
+        gint32 v = gain + dd_brute(&child);
+        if (maximize) {
+            best = v > best ? v : best;
+        } else {
+            best = v < best ? v : best;
+        }
+    }
+
+    return best;
+}
+
+void
+dd_random_state(struct dd_state* s,
+                struct rng* r,
+                guint32 nplayers,
+                guint32 ncards)
+{
+    guint8 slots[PINOCHLE_DECK_MAX_CARDS];
+    guint32 total = card_set_slots(card_set_full(2), slots);
+    for (guint32 i = 0; i < nplayers * ncards; i++) {
+        guint32 j = (guint32)rng_int_range(r, (gint32)i, (gint32)total);
+        guint8 tmp = slots[i];
+        slots[i] = slots[j];
+        slots[j] = tmp;
+    }
+    s->nplayers = nplayers;
+    for (guint32 i = 0; i < nplayers; i++) {
+        s->hands[i] = card_set_empty();
+        for (guint32 k = 0; k < ncards; k++) {
+            card_set_add_slot(&s->hands[i], slots[i * ncards + k]);
+        }
+    }
+    trick_clear(&s->trick);
+    s->leader = (guint32)rng_int_range(r, 0, (gint32)nplayers);
+    s->trump = (enum suit)rng_int_range(r, 0, (gint32)NSUIT);
+}
+
+/* console solve <seed> [nplayers] [memory_mb] */
+int
+dd_main(int argc, char** argv)
+{
+    if (argc < 3) {
+        printf("usage: %s solve <seed> [nplayers] [memory_mb]\n", argv[0]);
+
+        return 1;
+    }
+    guint64 seed = g_ascii_strtoull(argv[2], NULL, 10);
+    guint32 nplayers =
+      argc > 3 ? (guint32)g_ascii_strtoull(argv[3], NULL, 10) : NPLAYERS;
+    gsize memory_mb = argc > 4 ? g_ascii_strtoull(argv[4], NULL, 10) : 256;
+    if (nplayers < 2 || nplayers > TRICK_MAX_CARDS) {
+        printf("ERROR: nplayers must be between 2 and %u.\n", TRICK_MAX_CARDS);
+
+        return 1;
+    }
+
+    const gchar* names[] = { "north", "east", "south", "west" };
+    struct pinochle* p = pinochle_new(nplayers, NDECKS, names, seed);
+    pinochle_deal_init(p);
+    /* the player on lead picks the trump that gives them the most meld */
+    guint32 meld = 0;
+    guint32 leader = (pinochle_dealer_seat(p) + 1) % nplayers;
+    enum suit trump = meld_best_trump(p->hands[leader].cards, &meld);
+    pinochle_play_begin(p, trump);
+
+    struct dd_solver* dd = dd_solver_new(memory_mb << 20);
+    struct dd_state s;
+    dd_state_from_game(&s, p);
+    guint32 points[2];
+    gint64 start = g_get_monotonic_time();
+    dd_solve(dd, &s, points);
+    gint64 elapsed = g_get_monotonic_time() - start;
+
+    printf("trump,%u\n", trump);
+    printf("side_0,%u\n", points[0]);
+    printf("side_1,%u\n", points[1]);
+    printf("nodes,%" G_GUINT64_FORMAT "\n", dd->nodes);
+    printf("seconds,%.3f\n", (double)elapsed / G_USEC_PER_SEC);
+
+    dd_solver_free(dd);
+    pinochle_free(p);
+
+    return 0;
+}
+
+void
+dd_tests()
+{
+    printf("[+] Running tests for solver.\n");
+
+    struct dd_solver* dd = dd_solver_new(1 << 20);
+    struct rng r;
+    rng_seed(&r, 8);
+
+    /* test against plain minimax on small two and four player endings */
+    for (guint32 i = 0; i < 200; i++) {
+        struct dd_state s;
+        dd_random_state(&s, &r, i % 2 == 0 ? 2 : 4, i % 2 == 0 ? 5 : 3);
+        guint32 points[2];
+        dd_solve(dd, &s, points);
+        assert((gint32)points[0] == dd_brute(&s));
+        assert(points[0] + points[1] ==
+               dd_counters_out(&s) + LAST_TRICK_POINTS);
+    }
+
+    /* test mid-trick positions */
+    for (guint32 i = 0; i < 50; i++) {
+        struct dd_state s;
+        dd_random_state(&s, &r, 2, 5);
+        guint8 lead =
+          (guint8)bit_first(card_set_presence(s.hands[s.leader]));
+        card_set_remove_slot(&s.hands[s.leader], lead);
+        trick_play(&s.trick, lead, s.trump);
+        guint32 points[2];
+        dd_solve(dd, &s, points);
+        assert((gint32)points[0] == dd_brute(&s));
+    }
+
+    /* test a tiny table still gives the right answer */
+    struct dd_solver* dd2 = dd_solver_new(64);
+    for (guint32 i = 0; i < 20; i++) {
+        struct dd_state s;
+        dd_random_state(&s, &r, 2, 5);
+        guint32 points[2];
+        dd_solve(dd2, &s, points);
+        assert((gint32)points[0] == dd_brute(&s));
+    }
+    dd_solver_free(dd2);
+
+    /* test a whole two player deal */
+    const gchar* n11[] = { "paulie walnuts", "silvio dante" };
+    struct pinochle* p11 = pinochle_new(2, 2, n11, 11);
+    pinochle_deal_init(p11);
+    pinochle_play_begin(p11, spades);
+    struct dd_state s11;
+    dd_state_from_game(&s11, p11);
+    guint32 points11[2];
+    dd_solve(dd, &s11, points11);
+    assert(points11[0] + points11[1] ==
+           dd_counters_out(&s11) + LAST_TRICK_POINTS);
+    pinochle_free(p11);
+
+    dd_solver_free(dd);
+
+    printf("[+] Finished tests for solver.\n");
+}
+/* ***** */
+
+/* *** bot *** */
+/* picks plays by determinized monte carlo search. the bot sees only what
+ * its seat could: its own hand, the cards played and the trick. it deals
+ * the unseen cards to the other hands (and the stock) at random, keeping
+ * only deals in which every earlier play was legal, so revealed voids and
+ * failures to beat are respected. it then scores each of its legal plays
+ * on that deal with a random play-out, or exactly with the solver once
+ * few cards are left. the play with the best mean over all deals wins.
+ * workers deal and score in parallel until the time budget runs out, on
+ * a pool of threads the bot keeps from bot_new() to bot_free().
+ * the same endings come up in many deals and decisions, so solved
+ * positions are kept in a memo shared by the workers.
+ * melds are never shown in this game, so they tell the bot nothing. */
+#define BOT_DD_MAX_CARDS 16
+#define BOT_DD_MEMORY (1 << 20)
+#define BOT_MEMO_MEMORY (8 << 20)
+#define BOT_DEAL_TRIES 32
+#define BOT_MAX_THREADS 64
+
+/* what the seat to act knows. */
+struct bot_view
+{
+    guint32 me;
+    guint32 nplayers;
+    enum suit trump;
+    struct card_set mine;
+    struct card_set unseen; /* not in my hand and not played */
+    guint32 counts[PINOCHLE_MAX_SEATS];
+    guint32 voids[PINOCHLE_MAX_SEATS]; /* one bit per suit */
+    guint32 first_leader;              /* who led the first trick */
+    guint8 plays[PINOCHLE_MAX_PLAYS];
+    guint32 nplays;
+    struct trick trick;
+    guint32 leader;
+};
+
+struct bot_worker
+{
+    struct bot* bot;
+    const struct bot_view* view;
+    struct rng rng;
+    struct dd_solver* dd;
+    struct memo* memo;
+    gint64 deadline;
+    guint32 max_samples;
+    guint8 moves[DD_MAX_MOVES];
+    guint32 nmoves;
+    gint64 totals[DD_MAX_MOVES];
+    guint64 nsamples;
+};
+
+struct bot
+{
+    guint32 nthreads;
+    gint64 budget_us;    /* 0 for no time limit */
+    guint32 max_samples; /* 0 for as many as the budget allows */
+    struct rng rng;
+    struct dd_solver* solvers[BOT_MAX_THREADS];
+    struct memo* memo; /* solved positions, or NULL to solve every time */
+    guint64 nsamples;  /* deals scored for the last decision */
+    /* the calling thread runs workers[0], and the pool threads take the
+     * others from ready and hand them back on done */
+    struct bot_worker workers[BOT_MAX_THREADS];
+    GThread* threads[BOT_MAX_THREADS];
+    GAsyncQueue* ready;
+    GAsyncQueue* done;
+    struct bot_worker stop; /* pushed once per thread to stop the pool */
+};
+
+/* reads what the seat to act knows from the game and its log. returns 1
+ * on success and 0 for the 80 card game, whose fourth copies a view has
+ * no room for. */
+unsigned int
+bot_view_from_game(struct bot_view* v, struct pinochle* p)
+{
+    memset(v, 0, sizeof(*v));
+    if (p->deck->ndecks > CARD_SET_MAX_COPIES) {
+        printf("ERROR: the bot cannot play with %u decks.\n",
+               p->deck->ndecks);
+
+        return 0;
+    }
+    v->me = pinochle_to_act(p);
+    v->nplayers = p->nplayers;
+    v->trump = p->trump;
+    v->mine = p->hands[v->me].cards;
+    v->trick = p->trick;
+    v->leader = p->leader;
+    struct card_set played = card_set_empty();
+    for (guint32 i = 0; i < p->nactions; i++) {
+        struct action* a = &p->actions[i];
+        if (a->kind == action_trump) {
+            v->first_leader = a->seat;
+        } else if (a->kind == action_play && v->nplays < PINOCHLE_MAX_PLAYS) {
+            v->plays[v->nplays++] = (guint8)a->value;
+            card_set_add_slot(&played, (guint8)a->value);
+        }
+    }
+    v->unseen = card_set_subtract(
+      card_set_subtract(card_set_full(p->deck->ndecks), v->mine), played);
+    for (guint32 seat = 0; seat < p->nplayers; seat++) {
+        v->counts[seat] = card_set_count(p->hands[seat].cards);
+    }
+
+    /* a seat that did not follow the suit led has none of it, and if it
+     * did not trump either it has no trump */
+    struct trick t;
+    trick_clear(&t);
+    guint32 leader = v->first_leader;
+    for (guint32 i = 0; i < v->nplays; i++) {
+        guint32 seat = (leader + t.ncards) % v->nplayers;
+        guint8 slot = v->plays[i];
+        if (t.ncards > 0) {
+            guint32 led = card_slot_suit(t.slots[0]);
+            guint32 suit = card_slot_suit(slot);
+            if (suit != led) {
+                v->voids[seat] |= 1u << led;
+                if (suit != (guint32)v->trump) {
+                    v->voids[seat] |= 1u << v->trump;
+                }
+            }
+        }
+        trick_play(&t, slot, v->trump);
+        if (t.ncards == v->nplayers) {
+            leader = (leader + t.winner) % v->nplayers;
+            trick_clear(&t);
+        }
+    }
+
+    return 1;
+}
+
+/* whether every play in the view was legal had the hands before it been
+ * hands plus the cards each seat has since played. */
+unsigned int
+bot_deal_fits(const struct bot_view* v, const struct card_set* hands)
+{
+    struct card_set before[PINOCHLE_MAX_SEATS];
+    memcpy(before, hands, v->nplayers * sizeof(struct card_set));
+    struct trick t;
+    trick_clear(&t);
+    guint32 leader = v->first_leader;
+    guint32 seats[PINOCHLE_MAX_PLAYS];
+    for (guint32 i = 0; i < v->nplays; i++) {
+        seats[i] = (leader + t.ncards) % v->nplayers;
+        card_set_add_slot(&before[seats[i]], v->plays[i]);
+        trick_play(&t, v->plays[i], v->trump);
+        if (t.ncards == v->nplayers) {
+            leader = (leader + t.winner) % v->nplayers;
+            trick_clear(&t);
+        }
+    }
+    trick_clear(&t);
+    for (guint32 i = 0; i < v->nplays; i++) {
+        struct card_set legal = trick_legal(&t, before[seats[i]], v->trump);
+        if (((legal.bits >> v->plays[i]) & CARD_SET_FIELD_MASK) == 0) {
+            return 0;
+        }
+        card_set_remove_slot(&before[seats[i]], v->plays[i]);
+        trick_play(&t, v->plays[i], v->trump);
+        if (t.ncards == v->nplayers) {
+            trick_clear(&t);
+        }
+    }
+
+    return 1;
+}
+
+/* deals the unseen cards to the other seats, honouring the voids. returns
+ * 0 if the cards ran out of places to go. */
+unsigned int
+bot_deal_once(const struct bot_view* v, struct rng* r, struct card_set* hands)
+{
+    guint8 slots[PINOCHLE_DECK_MAX_CARDS];
+    guint32 n = card_set_slots(v->unseen, slots);
+    guint32 room[PINOCHLE_MAX_SEATS + 1];
+    guint32 stock = n;
+    for (guint32 seat = 0; seat < v->nplayers; seat++) {
+        hands[seat] = seat == v->me ? v->mine : card_set_empty();
+        room[seat] = seat == v->me ? 0 : v->counts[seat];
+        stock -= room[seat];
+    }
+    room[v->nplayers] = stock; /* never void */
+
+    for (guint32 i = 0; i < n; i++) {
+        guint32 j = (guint32)rng_int_range(r, (gint32)i, (gint32)n);
+        guint8 slot = slots[j];
+        slots[j] = slots[i];
+        guint32 suit = card_slot_suit(slot);
+        guint32 open = 0;
+        for (guint32 seat = 0; seat <= v->nplayers; seat++) {
+            if (seat == v->nplayers || ((v->voids[seat] >> suit) & 1) == 0) {
+                open += room[seat];
+            }
+        }
+        if (open == 0) {
+            return 0;
+        }
+        guint32 pick = (guint32)rng_int_range(r, 0, (gint32)open);
+        for (guint32 seat = 0; seat <= v->nplayers; seat++) {
+            if (seat < v->nplayers && ((v->voids[seat] >> suit) & 1) != 0) {
+                continue;
+            }
+            if (pick < room[seat]) {
+                if (seat < v->nplayers) {
+                    card_set_add_slot(&hands[seat], slot);
+                }
+                room[seat]--;
+                break;
+            }
+            pick -= room[seat];
+        }
+    }
+
+    return 1;
+}
+
+/* a random deal of the unseen cards that fits everything seen so far. if
+ * none turns up in BOT_DEAL_TRIES tries, one that fits the voids or at
+ * worst just the hand sizes. */
+void
+bot_deal(const struct bot_view* v, struct rng* r, struct card_set* hands)
+{
+    struct bot_view loose;
+    for (guint32 i = 0; i < BOT_DEAL_TRIES; i++) {
+        if (bot_deal_once(v, r, hands) && bot_deal_fits(v, hands)) {
+            return;
+        }
+    }
+    for (guint32 i = 0; i < BOT_DEAL_TRIES; i++) {
+        if (bot_deal_once(v, r, hands)) {
+            return;
+        }
+    }
+    loose = *v;
+    memset(loose.voids, 0, sizeof(loose.voids));
+    bot_deal_once(&loose, r, hands);
+}
+
+/* plays out s with random legal cards. returns the points taken from here
+ * on by seat 0's side. */
+gint32
+bot_playout(struct dd_state* s, struct rng* r)
+{
+    gint32 points = 0;
+    while (s->trick.ncards > 0 || s->hands[s->leader].bits != 0) {
+        guint32 seat = (s->leader + s->trick.ncards) % s->nplayers;
+        guint64 legal = card_set_presence(
+          trick_legal(&s->trick, s->hands[seat], s->trump));
+        for (gint32 k = rng_int_range(r, 0, (gint32)bit_count(legal)); k > 0;
+             k--) {
+            legal &= legal - 1;
+        }
+        guint8 slot = (guint8)bit_first(legal);
+        card_set_remove_slot(&s->hands[seat], slot);
+        trick_play(&s->trick, slot, s->trump);
+        if (s->trick.ncards == s->nplayers) {
+            guint32 winner = (s->leader + s->trick.winner) % s->nplayers;
+            gint32 taken = (gint32)s->trick.counters;
+            if (s->hands[seat].bits == 0) {
+                taken += (gint32)LAST_TRICK_POINTS;
+            }
+            if (dd_team(winner, s->nplayers) == 0) {
+                points += taken;
+            }
+            s->leader = winner;
+            trick_clear(&s->trick);
+        }
+    }
+
+    return points;
+}
+
+/* a key for a position: the hands, whose turn it is and the trick. every
+ * solver has the same zobrist keys, so any worker's will do. */
+guint64
+bot_position_key(struct dd_solver* dd, struct dd_state* s)
+{
+    guint64 rest = s->leader | (guint64)s->trump << 2 |
+                   (guint64)s->nplayers << 4 | (guint64)s->trick.ncards << 8;
+    for (guint32 i = 0; i < s->trick.ncards; i++) {
+        rest |= (guint64)s->trick.slots[i] << (16 + 8 * i);
+    }
+
+    return dd_hash(dd, s) ^ memo_mix(rest);
+}
+
+/* the points seat 0's side takes from here on if seat 0 plays slot. */
+gint32
+bot_score(struct bot_worker* w, const struct dd_state* s, guint8 slot)
+{
+    struct dd_state c = *s;
+    gint32 points = 0;
+    card_set_remove_slot(&c.hands[0], slot);
+    trick_play(&c.trick, slot, c.trump);
+    if (c.trick.ncards == c.nplayers) {
+        guint32 winner = (c.leader + c.trick.winner) % c.nplayers;
+        if (dd_team(winner, c.nplayers) == 0) {
+            points += (gint32)c.trick.counters;
+            if (c.hands[0].bits == 0) {
+                points += (gint32)LAST_TRICK_POINTS;
+            }
+        }
+        c.leader = winner;
+        trick_clear(&c.trick);
+    }
+    guint32 left = 0;
+    for (guint32 seat = 0; seat < c.nplayers; seat++) {
+        left += card_set_count(c.hands[seat]);
+    }
+    if (left == 0) {
+        return points;
+    }
+    if (left <= BOT_DD_MAX_CARDS) {
+        guint64 key = w->memo != NULL ? bot_position_key(w->dd, &c) : 0;
+        guint64 known = 0;
+        if (w->memo != NULL && memo_get(w->memo, key, &known)) {
+            return points + (gint32)known;
+        }
+        guint32 sides[2];
+        dd_solve(w->dd, &c, sides);
+        if (w->memo != NULL) {
+            memo_put(w->memo, key, sides[0]);
+        }
+
+        return points + (gint32)sides[0];
+    }
+
+    return points + bot_playout(&c, &w->rng);
+}
+
+gpointer
+bot_worker_run(gpointer data)
+{
+    struct bot_worker* w = data;
+    const struct bot_view* v = w->view;
+    struct card_set hands[PINOCHLE_MAX_SEATS];
+    /* at least one deal, however short the budget */
+    while (w->nsamples == 0 ||
+           (w->nsamples < w->max_samples &&
+            (w->deadline == 0 || g_get_monotonic_time() < w->deadline))) {
+        bot_deal(v, &w->rng, hands);
+        /* turn the table so the bot sits in seat 0, the solver's side */
+        struct dd_state s;
+        s.nplayers = v->nplayers;
+        for (guint32 seat = 0; seat < v->nplayers; seat++) {
+            s.hands[(seat + v->nplayers - v->me) % v->nplayers] = hands[seat];
+        }
+        s.trick = v->trick;
+        s.leader = (v->leader + v->nplayers - v->me) % v->nplayers;
+        s.trump = v->trump;
+        for (guint32 i = 0; i < w->nmoves; i++) {
+            w->totals[i] += bot_score(w, &s, w->moves[i]);
+        }
+        w->nsamples++;
+    }
+
+    return NULL;
+}
+
+gpointer
+bot_pool_run(gpointer data)
+{
+    struct bot* b = data;
+    for (;;) {
+        struct bot_worker* w = g_async_queue_pop(b->ready);
+        if (w == &b->stop) {
+            return NULL;
+        }
+        bot_worker_run(w);
+        g_async_queue_push(b->done, w);
+    }
+}
+
+/* a bot that spends about budget_us deciding on nthreads threads. */
+struct bot*
+bot_new(guint32 nthreads, gint64 budget_us, guint64 seed)
+{
+    struct bot* b = calloc(1, sizeof(struct bot));
+    b->nthreads = nthreads == 0              ? 1
+                  : nthreads > BOT_MAX_THREADS ? BOT_MAX_THREADS
+                                               : nthreads;
+    b->budget_us = budget_us;
+    rng_seed(&b->rng, seed);
+    for (guint32 i = 0; i < b->nthreads; i++) {
+        b->solvers[i] = dd_solver_new(BOT_DD_MEMORY);
+    }
+    b->memo = memo_new(BOT_MEMO_MEMORY, 4 * b->nthreads, memo_lru);
+    b->ready = g_async_queue_new();
+    b->done = g_async_queue_new();
+    for (guint32 i = 1; i < b->nthreads; i++) {
+        b->threads[i] = g_thread_new("bot", bot_pool_run, b);
+    }
+
+    return b;
+}
+
+void
+bot_free(struct bot* b)
+{
+    for (guint32 i = 1; i < b->nthreads; i++) {
+        g_async_queue_push(b->ready, &b->stop);
+    }
+    for (guint32 i = 1; i < b->nthreads; i++) {
+        g_thread_join(b->threads[i]);
+    }
+    g_async_queue_unref(b->ready);
+    g_async_queue_unref(b->done);
+    for (guint32 i = 0; i < b->nthreads; i++) {
+        dd_solver_free(b->solvers[i]);
+    }
+    if (b->memo != NULL) {
+        memo_free(b->memo);
+    }
+    free(b);
+}
+
+/* the slot the seat to act should play. in a game the bot cannot read,
+ * the first legal card, as the simple bots play. */
+guint8
+bot_choose_play(struct bot* b, struct pinochle* p)
+{
+    struct bot_view v;
+    unsigned int readable = bot_view_from_game(&v, p);
+    guint64 legal = card_set_presence(pinochle_legal_plays(p));
+    guint8 moves[DD_MAX_MOVES];
+    guint32 nmoves = 0;
+    for (; legal != 0; legal &= legal - 1) {
+        moves[nmoves++] = (guint8)bit_first(legal);
+    }
+    b->nsamples = 0;
+    if (nmoves == 1 || readable == 0) {
+        return moves[0];
+    }
+
+    struct bot_worker* workers = b->workers;
+    gint64 deadline =
+      b->budget_us > 0 ? g_get_monotonic_time() + b->budget_us : 0;
+    for (guint32 i = 0; i < b->nthreads; i++) {
+        struct bot_worker* w = &workers[i];
+        memset(w, 0, sizeof(*w));
+        w->bot = b;
+        w->view = &v;
+        rng_split(&b->rng, &w->rng);
+        w->dd = b->solvers[i];
+        w->memo = b->memo;
+        w->deadline = deadline;
+        w->max_samples = b->max_samples == 0
+                           ? (deadline == 0 ? 1 : G_MAXUINT32)
+                           : (b->max_samples + b->nthreads - 1 - i) /
+                               b->nthreads;
+        memcpy(w->moves, moves, nmoves);
+        w->nmoves = nmoves;
+        if (i > 0) {
+            g_async_queue_push(b->ready, w);
+        }
+    }
+    bot_worker_run(&workers[0]);
+    for (guint32 i = 1; i < b->nthreads; i++) {
+        g_async_queue_pop(b->done);
+    }
+
+    gint64 totals[DD_MAX_MOVES] = { 0 };
+    for (guint32 i = 0; i < b->nthreads; i++) {
+        for (guint32 m = 0; m < nmoves; m++) {
+            totals[m] += workers[i].totals[m];
+        }
+        b->nsamples += workers[i].nsamples;
+    }
+    guint32 best = 0;
+    for (guint32 m = 1; m < nmoves; m++) {
+        if (totals[m] > totals[best]) {
+            best = m;
+        }
+    }
+
+    return moves[best];
+}
+
+/* plays a deal out with the bot in seat 0 (and its partner) and the first
+ * legal card everywhere else. bot may be NULL for no bot at all. returns
+ * the points of seat 0's side. */
+guint32
+bot_play_deal(struct bot* b, guint32 nplayers, guint64 seed)
+{
+    const gchar* names[] = { "north", "east", "south", "west" };
+    struct pinochle* p = pinochle_new(nplayers, NDECKS, names, seed);
+    pinochle_deal_init(p);
+    pinochle_play_begin(p, bid_estimate(p->hands[0].cards).trump);
+    while (pinochle_is_over(p) == 0) {
+        guint32 seat = pinochle_to_act(p);
+        if (b != NULL && pinochle_team(p, seat) == pinochle_team(p, 0)) {
+            pinochle_play_slot(p, bot_choose_play(b, p));
+        } else {
+            struct card_set legal = pinochle_legal_plays(p);
+            pinochle_play_slot(p, (guint8)bit_first(card_set_presence(legal)));
+        }
+    }
+    guint32 points = pinochle_team_points(p, pinochle_team(p, 0));
+    pinochle_free(p);
+
+    return points;
+}
+
+/* console duel <ndeals> [budget_ms] [nthreads] [nplayers] */
+int
+bot_main(int argc, char** argv)
+{
+    if (argc < 3) {
+        printf("usage: %s duel <ndeals> [budget_ms] [nthreads] [nplayers]\n",
+               argv[0]);
+
+        return 1;
+    }
+    guint64 ndeals = g_ascii_strtoull(argv[2], NULL, 10);
+    gint64 budget_ms = argc > 3 ? (gint64)g_ascii_strtoull(argv[3], NULL, 10)
+                                : 50;
+    guint32 nthreads = argc > 4 ? (guint32)g_ascii_strtoull(argv[4], NULL, 10)
+                                : g_get_num_processors();
+    guint32 nplayers =
+      argc > 5 ? (guint32)g_ascii_strtoull(argv[5], NULL, 10) : NPLAYERS;
+    if (pinochle_variant_find(nplayers, NDECKS) == NULL) {
+        printf("ERROR: pinochle is not played by %u players.\n", nplayers);
+
+        return 1;
+    }
+
+    struct bot* b = bot_new(nthreads, budget_ms * 1000, 1);
+    guint64 with_bot = 0;
+    guint64 without = 0;
+    gint64 start = g_get_monotonic_time();
+    for (guint64 seed = 0; seed < ndeals; seed++) {
+        with_bot += bot_play_deal(b, nplayers, seed);
+        without += bot_play_deal(NULL, nplayers, seed);
+    }
+    gint64 elapsed = g_get_monotonic_time() - start;
+    printf("deals,%" G_GUINT64_FORMAT "\n", ndeals);
+    printf("mean_points_bot,%.3f\n",
+           ndeals > 0 ? (double)with_bot / ndeals : 0.0);
+    printf("mean_points_first_legal,%.3f\n",
+           ndeals > 0 ? (double)without / ndeals : 0.0);
+    printf("seconds,%.3f\n", (double)elapsed / G_USEC_PER_SEC);
+    struct memo_stats st;
+    memo_stats(b->memo, &st);
+    memo_stats_show(&st, stdout);
+    bot_free(b);
+
+    return 0;
+}
+
+void
+bot_tests()
+{
+    printf("[+] Running tests for bot.\n");
+
+    /* test view_from_game() sees voids and only the unseen cards */
+    const gchar* n11[] = { "tony", "paulie", "silvio", "christopher" };
+    struct pinochle* p11 = pinochle_new(4, 2, n11, 11);
+    pinochle_deal_init(p11);
+    pinochle_play_begin(p11, hearts);
+    for (guint32 i = 0; i < 20; i++) {
+        struct card_set legal = pinochle_legal_plays(p11);
+        pinochle_play_slot(p11, (guint8)bit_first(card_set_presence(legal)));
+    }
+    struct bot_view v11;
+    assert(bot_view_from_game(&v11, p11) == 1);
+    assert(v11.me == pinochle_to_act(p11) && v11.nplays == 20);
+    assert(card_set_count(v11.unseen) == 48 - 20 - v11.counts[v11.me]);
+    struct card_set others11 = card_set_empty();
+    for (guint32 seat = 0; seat < 4; seat++) {
+        struct card_set hand = p11->hands[seat].cards;
+        if (seat != v11.me) {
+            others11 = card_set_merge(others11, hand);
+        }
+        for (guint32 suit = 0; suit < NSUIT; suit++) {
+            if ((v11.voids[seat] >> suit) & 1) {
+                assert(card_set_suit_count(hand, (enum suit)suit) == 0);
+            }
+        }
+    }
+    assert(others11.bits == v11.unseen.bits);
+
+    /* test the bot will not read the 80 card game and plays its first
+     * legal card there */
+    struct pinochle* p12 = pinochle_new(4, 4, n11, 12);
+    pinochle_deal_init(p12);
+    pinochle_play_begin(p12, hearts);
+    struct bot_view v12;
+    assert(bot_view_from_game(&v12, p12) == 0);
+    struct bot* b12 = bot_new(1, 0, 12);
+    assert(bot_choose_play(b12, p12) ==
+           bit_first(card_set_presence(pinochle_legal_plays(p12))));
+    bot_free(b12);
+    pinochle_free(p12);
+
+    /* test deal() gives every seat its count and fits the plays */
+    struct rng r11;
+    rng_seed(&r11, 11);
+    struct card_set hands11[PINOCHLE_MAX_SEATS];
+    for (guint32 seat = 0; seat < 4; seat++) {
+        hands11[seat] = p11->hands[seat].cards;
+    }
+    assert(bot_deal_fits(&v11, hands11) == 1);
+    for (guint32 i = 0; i < 100; i++) {
+        bot_deal(&v11, &r11, hands11);
+        struct card_set all = card_set_empty();
+        for (guint32 seat = 0; seat < 4; seat++) {
+            assert(card_set_count(hands11[seat]) == v11.counts[seat]);
+            if (seat != v11.me) {
+                all = card_set_merge(all, hands11[seat]);
+            }
+        }
+        assert(hands11[v11.me].bits == v11.mine.bits);
+        assert(all.bits == v11.unseen.bits);
+    }
+    pinochle_free(p11);
+
+    /* test with every card known the bot plays as well as the solver */
+    const gchar* n21[] = { "paulie walnuts", "silvio dante" };
+    struct bot* b21 = bot_new(1, 0, 21);
+    b21->max_samples = 4;
+    for (guint64 seed = 0; seed < 5; seed++) {
+        /* a single deck is dealt out, so the other hand is known */
+        struct pinochle* p21 = pinochle_new(2, 1, n21, seed);
+        pinochle_deal_init(p21);
+        pinochle_play_begin(p21, spades);
+        while (card_set_count(p21->hands[0].cards) +
+                 card_set_count(p21->hands[1].cards) >
+               6) {
+            struct card_set legal = pinochle_legal_plays(p21);
+            pinochle_play_slot(p21,
+                               (guint8)bit_first(card_set_presence(legal)));
+        }
+        guint32 me = pinochle_to_act(p21);
+        guint8 slot = bot_choose_play(b21, p21);
+        struct dd_state s21;
+        dd_state_from_game(&s21, p21);
+        guint64 legal = card_set_presence(pinochle_legal_plays(p21));
+        gint32 best = -1;
+        gint32 chosen = -1;
+        for (; legal != 0; legal &= legal - 1) {
+            struct bot_worker w;
+            memset(&w, 0, sizeof(w));
+            w.dd = b21->solvers[0];
+            struct dd_state turned = s21;
+            turned.hands[0] = s21.hands[me];
+            turned.hands[1] = s21.hands[1 - me];
+            turned.leader = (s21.leader + 2 - me) % 2;
+            gint32 v = bot_score(&w, &turned, (guint8)bit_first(legal));
+            best = v > best ? v : best;
+            if (bit_first(legal) == slot) {
+                chosen = v;
+            }
+        }
+        assert(chosen == best);
+        pinochle_free(p21);
+    }
+    bot_free(b21);
+
+    /* test the bot takes more than first legal card play over some deals */
+    struct bot* b31 = bot_new(2, 0, 31);
+    b31->max_samples = 16;
+    guint32 with31 = 0;
+    guint32 without31 = 0;
+    for (guint64 seed = 0; seed < 6; seed++) {
+        with31 += bot_play_deal(b31, 4, seed);
+        without31 += bot_play_deal(NULL, 4, seed);
+    }
+    assert(with31 > without31);
+    bot_free(b31);
+
+    /* test the memo changes nothing but the work done */
+    struct bot* b41 = bot_new(1, 0, 41);
+    struct bot* b42 = bot_new(1, 0, 41);
+    b41->max_samples = 8;
+    b42->max_samples = 8;
+    memo_free(b42->memo);
+    b42->memo = NULL;
+    for (guint64 seed = 0; seed < 2; seed++) {
+        struct pinochle* p41 = pinochle_new(2, 2, n21, seed);
+        pinochle_deal_init(p41);
+        pinochle_play_begin(p41, clubs);
+        while (pinochle_is_over(p41) == 0) {
+            guint8 slot = bot_choose_play(b41, p41);
+            assert(bot_choose_play(b42, p41) == slot);
+            pinochle_play_slot(p41, slot);
+        }
+        pinochle_free(p41);
+    }
+    struct memo_stats st41;
+    memo_stats(b41->memo, &st41);
+    assert(st41.hits > 0);
+    bot_free(b41);
+    bot_free(b42);
+
+    /* test the pool hands every worker back for each decision */
+    struct bot* b51 = bot_new(4, 0, 51);
+    b51->max_samples = 10;
+    struct pinochle* p51 = pinochle_new(2, 2, n21, 51);
+    pinochle_deal_init(p51);
+    pinochle_play_begin(p51, spades);
+    while (pinochle_is_over(p51) == 0) {
+        guint32 nlegal51 =
+          bit_count(card_set_presence(pinochle_legal_plays(p51)));
+        pinochle_play_slot(p51, bot_choose_play(b51, p51));
+        assert(b51->nsamples == (nlegal51 > 1 ? 10 : 0));
+    }
+    pinochle_free(p51);
+    bot_free(b51);
+
+    printf("[+] Finished tests for bot.\n");
+}
+/* ***** */
+
+/* *** simulate *** */
+/* runs many independent deals on every core and collects hand
+ * statistics, including the meld of each hand in its best trump. the
+ * deals are numbered and deal i is always played with seed (seed + i),
+ * so results depend only on the seed and the number of deals, never on
+ * how the deals were spread over the threads.
+ *
+ * with play-out each deal is also bid with auction_decide(), the high
+ * bidder takes the widow, names their best trump and buries, and every
+ * seat plays its first legal card, as the server's bots do, to count what
+ * each side takes.
+ *
+ * four players with four decks play the 80 card game, fourth copies and
+ * all.
+ *
+ * every worker starts with an equal share of the deal numbers and runs
+ * them SIM_CHUNK at a time. a worker that runs out steals the back half
+ * of another worker's remaining range. each worker adds up its results
+ * in a private sim_stats that is merged once at the end. */
+#define SIM_CHUNK 1024
+#define SIM_HIST_BINS 64
+#define SIM_MELD_BINS 64
+
+struct sim_stats
+{
+    guint64 ndeals;
+    guint64 nhands;
+    /* hands by number of counter cards */
+    guint64 counters[SIM_HIST_BINS];
+    /* hands by length of their longest suit */
+    guint64 longest_suit[SIM_HIST_BINS];
+    /* hands by meld in their best trump; the last bin holds the rest */
+    guint64 meld[SIM_MELD_BINS];
+    guint64 meld_sum;
+    /* with play-out: deals by points the bidder's side took, and the
+     * points taken by the bidder's side and by the other sides */
+    guint64 nplayed;
+    guint64 bidder_points[SIM_HIST_BINS];
+    guint64 bidder_points_sum;
+    guint64 defender_points_sum;
+};
+
+struct sim_worker
+{
+    GMutex lock;
+    guint64 next; /* next deal to run */
+    guint64 end;  /* one past the last deal to run */
+    guint32 id;
+    struct sim* sim;
+    struct sim_stats stats;
+};
+
+struct sim
+{
+    guint32 nplayers;
+    guint32 ndecks;
+    guint64 seed;
+    guint32 playout;
+    guint32 nworkers;
+    struct sim_worker* workers;
+};
+
+void
+sim_stats_merge(struct sim_stats* into, struct sim_stats* from)
+{
+    into->ndeals += from->ndeals;
+    into->nhands += from->nhands;
+    for (unsigned long i = 0; i < SIM_HIST_BINS; i++) {
+        into->counters[i] += from->counters[i];
+        into->longest_suit[i] += from->longest_suit[i];
+    }
+    for (unsigned long i = 0; i < SIM_MELD_BINS; i++) {
+        into->meld[i] += from->meld[i];
+    }
+    into->meld_sum += from->meld_sum;
+    into->nplayed += from->nplayed;
+    for (unsigned long i = 0; i < SIM_HIST_BINS; i++) {
+        into->bidder_points[i] += from->bidder_points[i];
+    }
+    into->bidder_points_sum += from->bidder_points_sum;
+    into->defender_points_sum += from->defender_points_sum;
+}
+
+guint32
+sim_hist_bin(guint32 value)
+{
+    return value < SIM_HIST_BINS ? value : SIM_HIST_BINS - 1;
+}
+
+/* bids a dealt game the way the bots do and declares for the high
+ * bidder. returns the high bidder. */
+guint32
+sim_bid(struct pinochle* p)
+{
+    pinochle_auction_begin(p);
+    while (p->auction.done == 0) {
+        guint32 bid = pinochle_decide_bid(p);
+        if (bid > 0) {
+            pinochle_bid(p, bid);
+        } else {
+            pinochle_pass(p);
+        }
+    }
+    guint32 bidder = p->auction.high_bidder;
+    pinochle_declare_best(p);
+
+    return bidder;
+}
+
+/* bids and plays out a dealt game and counts the points by side. */
+void
+sim_playout(struct pinochle* p, struct sim_stats* stats)
+{
+    guint32 bidder = sim_bid(p);
+    while (pinochle_is_over(p) == 0) {
+        struct card_set legal = pinochle_legal_plays(p);
+        pinochle_play_slot(p, (guint8)bit_first(card_set_presence(legal)));
+    }
+
+    guint32 side = pinochle_team(p, bidder);
+    guint32 taken = pinochle_team_points(p, side);
+    guint32 others = 0;
+    for (guint32 team = 0; team < p->variant->nteams; team++) {
+        others += team != side ? pinochle_team_points(p, team) : 0;
+    }
+    stats->nplayed++;
+    stats->bidder_points[sim_hist_bin(taken)]++;
+    stats->bidder_points_sum += taken;
+    stats->defender_points_sum += others;
+}
+
+void
+sim_deal(struct pinochle* p,
+         guint64 seed,
+         guint32 playout,
+         struct sim_stats* stats)
+{
+    pinochle_reset(p, seed);
+    pinochle_deal_init(p);
+    stats->ndeals++;
+    for (guint32 seat = 0; seat < p->nplayers; seat++) {
+        struct card_set hand = p->hands[seat].cards;
+        struct card_set extra = p->hands[seat].extra;
+        guint32 longest = 0;
+        for (unsigned long i = 0; i < NSUIT; i++) {
+            guint32 len = card_set_suit_count(hand, SUITS[i]) +
+                          card_set_suit_count(extra, SUITS[i]);
+            longest = len > longest ? len : longest;
+        }
+        guint32 counters =
+          card_set_count_counters(hand) + card_set_count_counters(extra);
+        stats->nhands++;
+        stats->counters[sim_hist_bin(counters)]++;
+        stats->longest_suit[sim_hist_bin(longest)]++;
+        guint32 meld = 0;
+        meld_best_trump_extra(hand, extra, &meld);
+        stats->meld[meld < SIM_MELD_BINS ? meld : SIM_MELD_BINS - 1]++;
+        stats->meld_sum += meld;
+    }
+    if (playout) {
+        sim_playout(p, stats);
+    }
+}
+
+/* the bid tables are the mean points, in tenths, that a lane of a
+ * two-handed hand takes when it is trump and when it is not. each of
+ * SIM_BID_DEALS deals is played out once with every suit as trump, with
+ * no auction, so the tables do not depend on the bids made with them.
+ * the points of every trick, the last trick's included, go to the lane
+ * that held the card which won it. a lane seen in few hands is pulled
+ * toward bid_prior_tables(), as if it had been seen SIM_BID_PRIOR_HANDS
+ * more times taking what the rule of thumb says. */
+#define SIM_BID_DEALS 1000000
+#define SIM_BID_PRIOR_HANDS 8
+
+struct sim_bid_lanes
+{
+    guint64 points[2][MELD_LANE_PATTERNS]; /* by not trump, trump */
+    guint64 hands[2][MELD_LANE_PATTERNS];
+};
+
+/* plays out a dealt game with trump as sim_playout() does and adds what
+ * every lane of every hand took to lanes. */
+void
+sim_bid_playout(struct pinochle* p,
+                enum suit trump,
+                struct sim_bid_lanes* lanes)
+{
+    pinochle_play_begin(p, trump);
+    guint32 nplayers = p->nplayers;
+    struct card_set hands[PINOCHLE_MAX_SEATS];
+    guint32 taken[PINOCHLE_MAX_SEATS][4] = { { 0 } }; /* by seat and suit */
+    for (guint32 seat = 0; seat < nplayers; seat++) {
+        hands[seat] = p->hands[seat].cards;
+    }
+    while (pinochle_is_over(p) == 0) {
+        guint8 slot =
+          (guint8)bit_first(card_set_presence(pinochle_legal_plays(p)));
+        struct trick t = p->trick;
+        guint32 leader = p->leader;
+        trick_play(&t, slot, p->trump);
+        pinochle_play_slot(p, slot);
+        if (t.ncards == nplayers) {
+            guint32 winner = (leader + t.winner) % nplayers;
+            taken[winner][card_slot_suit(t.slots[t.winner])] +=
+              t.counters + (pinochle_is_over(p) ? LAST_TRICK_POINTS : 0);
+        }
+    }
+    for (guint32 seat = 0; seat < nplayers; seat++) {
+        for (unsigned long i = 0; i < NSUIT; i++) {
+            guint32 lane = meld_lane(hands[seat], SUITS[i]);
+            guint32 is_trump = SUITS[i] == trump;
+            lanes->points[is_trump][lane] += taken[seat][SUITS[i]];
+            lanes->hands[is_trump][lane]++;
+        }
+    }
+}
+
+/* measures the bid tables over ndeals two-handed deals from seed. */
+void
+sim_bid_tables(guint8* trump_lane,
+               guint8* plain_lane,
+               guint64 ndeals,
+               guint64 seed)
+{
+    struct sim_bid_lanes* lanes = calloc(1, sizeof(struct sim_bid_lanes));
+    const gchar* names[] = { "north", "south" };
+    struct pinochle* p = pinochle_new(NPLAYERS, NDECKS, names, seed);
+    for (guint64 i = 0; i < ndeals; i++) {
+        for (unsigned long k = 0; k < NSUIT; k++) {
+            pinochle_reset(p, seed + i);
+            pinochle_deal_init(p);
+            sim_bid_playout(p, SUITS[k], lanes);
+        }
+    }
+    pinochle_free(p);
+
+    bid_prior_tables(trump_lane, plain_lane);
+    guint8* tables[2] = { plain_lane, trump_lane };
+    for (guint32 trump = 0; trump < 2; trump++) {
+        for (guint32 lane = 0; lane < MELD_LANE_PATTERNS; lane++) {
+            guint64 n = lanes->hands[trump][lane] + SIM_BID_PRIOR_HANDS;
+            guint64 sum = 10 * lanes->points[trump][lane] +
+                          SIM_BID_PRIOR_HANDS * tables[trump][lane];
+            guint64 mean = (sum + n / 2) / n;
+            tables[trump][lane] = (guint8)(mean < 255 ? mean : 255);
+        }
+    }
+    free(lanes);
+}
+
+/* writes the tables from sim_bid_tables() as C source to path. returns 1
+ * on success and 0 on error. */
+unsigned int
+bid_write_tables(const char* path)
+{
+    static guint8 trump_lane[MELD_LANE_PATTERNS];
+    static guint8 plain_lane[MELD_LANE_PATTERNS];
+    sim_bid_tables(trump_lane, plain_lane, SIM_BID_DEALS, 1);
+
+    FILE* f = fopen(path, "w");
+    if (f == NULL) {
+        printf("ERROR: Cannot open %s for writing.\n", path);
+
+        return 0;
+    }
+    fprintf(f,
+            "/* generated by `console bid-table` from %u play-outs; do not "
+            "edit. */\n\n",
+            (guint32)SIM_BID_DEALS);
+    bid_write_array(f, "BID_TRUMP_LANE", trump_lane);
+    fprintf(f, "\n");
+    bid_write_array(f, "BID_PLAIN_LANE", plain_lane);
+    fclose(f);
+
+    return 1;
+}
+
+/* takes the next chunk of w's own range. returns 0 if it is empty. */
+unsigned int
+sim_worker_take(struct sim_worker* w, guint64* begin, guint64* end)
+{
+    unsigned int ok = 0;
+    g_mutex_lock(&w->lock);
+    if (w->next < w->end) {
+        *begin = w->next;
+        *end = w->end - w->next > SIM_CHUNK ? w->next + SIM_CHUNK : w->end;
+        w->next = *end;
+        ok = 1;
+    }
+    g_mutex_unlock(&w->lock);
+
+    return ok;
+}
+
+/* moves the back half of another worker's range to w. returns 0 if
+ * every other worker is out of work. */
+unsigned int
+sim_worker_steal(struct sim_worker* w)
+{
+    struct sim* sim = w->sim;
+    for (guint32 i = 1; i < sim->nworkers; i++) {
+        struct sim_worker* victim = &sim->workers[(w->id + i) % sim->nworkers];
+        guint64 begin = 0;
+        guint64 end = 0;
+        g_mutex_lock(&victim->lock);
+        if (victim->next < victim->end) {
+            guint64 left = victim->end - victim->next;
+            begin = left > SIM_CHUNK ? victim->next + left / 2 : victim->next;
+            end = victim->end;
+            victim->end = begin;
+        }
+        g_mutex_unlock(&victim->lock);
+
+        if (begin < end) {
+            g_mutex_lock(&w->lock);
+            w->next = begin;
+            w->end = end;
+            g_mutex_unlock(&w->lock);
+
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+gpointer
+sim_worker_run(gpointer data)
+{
+    struct sim_worker* w = data;
+    struct sim* sim = w->sim;
+    const gchar* names[] = { "north", "east", "south", "west" };
+    struct pinochle* p = pinochle_new(sim->nplayers, sim->ndecks, names, 0);
+
+    guint64 begin = 0;
+    guint64 end = 0;
+    for (;;) {
+        if (sim_worker_take(w, &begin, &end) == 0) {
+            if (sim_worker_steal(w) == 0) {
+                break;
+            }
+            continue;
+        }
+        for (guint64 i = begin; i < end; i++) {
+            sim_deal(p, sim->seed + i, sim->playout, &w->stats);
+        }
+    }
+
+    pinochle_free(p);
+
+    return NULL;
+}
+
+/* runs ndeals deals on nworkers threads and adds the results to out.
+ * plays each deal out too if playout is set. */
+void
+sim_run(guint32 nplayers,
+        guint32 ndecks,
+        guint64 ndeals,
+        guint32 nworkers,
+        guint64 seed,
+        guint32 playout,
+        struct sim_stats* out)
+{
+    struct sim sim = { nplayers, ndecks, seed, playout, nworkers, NULL };
+    sim.workers = calloc(nworkers, sizeof(struct sim_worker));
+    GThread** threads = calloc(nworkers, sizeof(GThread*));
+    for (guint32 i = 0; i < nworkers; i++) {
+        struct sim_worker* w = &sim.workers[i];
+        g_mutex_init(&w->lock);
+        w->next = ndeals * i / nworkers;
+        w->end = ndeals * (i + 1) / nworkers;
+        w->id = i;
+        w->sim = &sim;
+    }
+    for (guint32 i = 0; i < nworkers; i++) {
+        threads[i] = g_thread_new("sim", sim_worker_run, &sim.workers[i]);
+    }
+    for (guint32 i = 0; i < nworkers; i++) {
+        g_thread_join(threads[i]);
+        sim_stats_merge(out, &sim.workers[i].stats);
+        g_mutex_clear(&sim.workers[i].lock);
+    }
+    free(threads);
+    free(sim.workers);
+}
+
+void
+sim_stats_show(struct sim_stats* stats)
+{
+    printf("deals,%" G_GUINT64_FORMAT "\n", stats->ndeals);
+    printf("hands,%" G_GUINT64_FORMAT "\n", stats->nhands);
+    printf("cards,hands_by_counters,hands_by_longest_suit\n");
+    for (unsigned long i = 0; i < SIM_HIST_BINS; i++) {
+        if (stats->counters[i] == 0 && stats->longest_suit[i] == 0) {
+            continue;
+        }
+        printf("%lu,%" G_GUINT64_FORMAT ",%" G_GUINT64_FORMAT "\n",
+               i,
+               stats->counters[i],
+               stats->longest_suit[i]);
+    }
+    printf("meld,hands_by_best_meld\n");
+    for (unsigned long i = 0; i < SIM_MELD_BINS; i++) {
+        if (stats->meld[i] != 0) {
+            printf("%lu,%" G_GUINT64_FORMAT "\n", i, stats->meld[i]);
+        }
+    }
+    printf("mean_meld,%.3f\n",
+           stats->nhands > 0 ? (double)stats->meld_sum / stats->nhands : 0.0);
+    if (stats->nplayed == 0) {
+        return;
+    }
+    printf("played,%" G_GUINT64_FORMAT "\n", stats->nplayed);
+    printf("points,deals_by_bidder_side_points\n");
+    for (unsigned long i = 0; i < SIM_HIST_BINS; i++) {
+        if (stats->bidder_points[i] != 0) {
+            printf("%lu,%" G_GUINT64_FORMAT "\n", i, stats->bidder_points[i]);
+        }
+    }
+    printf("mean_bidder_side_points,%.3f\n",
+           (double)stats->bidder_points_sum / stats->nplayed);
+    printf("mean_defender_points,%.3f\n",
+           (double)stats->defender_points_sum / stats->nplayed);
+}
+
+/* console simulate <ndeals> [nthreads] [seed] [nplayers] [deal|playout]
+ * [ndecks] */
+int
+sim_main(int argc, char** argv)
+{
+    if (argc < 3) {
+        printf("usage: %s simulate <ndeals> [nthreads] [seed] [nplayers] "
+               "[deal|playout] [ndecks]\n",
+               argv[0]);
+
+        return 1;
+    }
+    guint64 ndeals = g_ascii_strtoull(argv[2], NULL, 10);
+    guint32 nworkers = argc > 3 ? (guint32)g_ascii_strtoull(argv[3], NULL, 10)
+                                : g_get_num_processors();
+    guint64 seed = argc > 4 ? g_ascii_strtoull(argv[4], NULL, 10) : 1;
+    guint32 nplayers =
+      argc > 5 ? (guint32)g_ascii_strtoull(argv[5], NULL, 10) : NPLAYERS;
+    guint32 playout = argc > 6 && g_strcmp0(argv[6], "playout") == 0;
+    guint32 ndecks =
+      argc > 7 ? (guint32)g_ascii_strtoull(argv[7], NULL, 10) : NDECKS;
+    if (nworkers == 0) {
+        nworkers = 1;
+    }
+    if (pinochle_variant_find(nplayers, ndecks) == NULL) {
+        printf("ERROR: pinochle is not played by %u players with %u decks.\n",
+               nplayers,
+               ndecks);
+
+        return 1;
+    }
+
+    struct sim_stats stats = { 0 };
+    gint64 start = g_get_monotonic_time();
+    sim_run(nplayers, ndecks, ndeals, nworkers, seed, playout, &stats);
+    gint64 elapsed = g_get_monotonic_time() - start;
+
+    sim_stats_show(&stats);
+    printf("threads,%u\n", nworkers);
+    printf("seconds,%.3f\n", (double)elapsed / G_USEC_PER_SEC);
+    printf("deals_per_second,%.0f\n",
+           elapsed > 0 ? (double)stats.ndeals * G_USEC_PER_SEC / elapsed : 0.0);
+
+    return 0;
+}
+
+void
+sim_tests()
+{
+    printf("[+] Running tests for simulate.\n");
+
+    /* test run() counts every deal and hand once */
+    struct sim_stats s11 = { 0 };
+    sim_run(2, 2, 5000, 3, 1, 0, &s11);
+    assert(s11.ndeals == 5000);
+    assert(s11.nhands == 10000);
+    guint64 total11 = 0;
+    for (unsigned long i = 0; i < SIM_HIST_BINS; i++) {
+        total11 += s11.counters[i];
+    }
+    assert(total11 == s11.nhands);
+
+    /* test results do not depend on the number of threads */
+    struct sim_stats s21 = { 0 };
+    sim_run(2, 2, 5000, 1, 1, 0, &s21);
+    for (unsigned long i = 0; i < SIM_HIST_BINS; i++) {
+        assert(s11.counters[i] == s21.counters[i]);
+        assert(s11.longest_suit[i] == s21.longest_suit[i]);
+    }
+    for (unsigned long i = 0; i < SIM_MELD_BINS; i++) {
+        assert(s11.meld[i] == s21.meld[i]);
+    }
+    assert(s11.meld_sum == s21.meld_sum);
+    assert(s11.nplayed == 0);
+
+    /* test play-out counts every point of a partnership deal once, and
+     * does not depend on the number of threads either */
+    struct sim_stats s31 = { 0 };
+    struct sim_stats s32 = { 0 };
+    sim_run(4, 2, 2000, 3, 1, 1, &s31);
+    sim_run(4, 2, 2000, 1, 1, 1, &s32);
+    assert(s31.nplayed == 2000 && s31.nhands == 8000);
+    guint64 played31 = 0;
+    for (unsigned long i = 0; i < SIM_HIST_BINS; i++) {
+        played31 += s31.bidder_points[i];
+        assert(s31.bidder_points[i] == s32.bidder_points[i]);
+    }
+    assert(played31 == s31.nplayed);
+    assert(s31.bidder_points_sum + s31.defender_points_sum ==
+           2000 * (24 + LAST_TRICK_POINTS));
+    assert(s31.bidder_points_sum == s32.bidder_points_sum);
+    /* the side that bid should take more than its share */
+    assert(s31.bidder_points_sum > s31.defender_points_sum);
+
+    /* test the three-handed widow comes into play, so again every point
+     * is taken */
+    struct sim_stats s41 = { 0 };
+    sim_run(3, 2, 1000, 2, 1, 1, &s41);
+    assert(s41.bidder_points_sum + s41.defender_points_sum ==
+           1000 * (24 + LAST_TRICK_POINTS));
+
+    /* test the 80 card game deals twenty cards a hand and plays them all */
+    struct sim_stats s51 = { 0 };
+    sim_run(4, 4, 500, 2, 1, 1, &s51);
+    assert(s51.nhands == 2000 && s51.nplayed == 500);
+    guint64 counters51 = 0;
+    for (unsigned long i = 0; i < SIM_HIST_BINS; i++) {
+        counters51 += i * s51.counters[i];
+    }
+    assert(counters51 == 500 * 48);
+    assert(s51.bidder_points_sum + s51.defender_points_sum ==
+           500 * (48 + LAST_TRICK_POINTS));
+
+    /* test the bid tables come out the same for the same deals, and lanes
+     * no two-deck hand holds keep the rule of thumb */
+    static guint8 trump61[MELD_LANE_PATTERNS];
+    static guint8 plain61[MELD_LANE_PATTERNS];
+    static guint8 trump62[MELD_LANE_PATTERNS];
+    static guint8 plain62[MELD_LANE_PATTERNS];
+    static guint8 trump63[MELD_LANE_PATTERNS];
+    static guint8 plain63[MELD_LANE_PATTERNS];
+    sim_bid_tables(trump61, plain61, 500, 61);
+    sim_bid_tables(trump62, plain62, 500, 61);
+    bid_prior_tables(trump63, plain63);
+    assert(memcmp(trump61, trump62, sizeof(trump61)) == 0);
+    assert(memcmp(plain61, plain62, sizeof(plain61)) == 0);
+    assert(trump61[MELD_LANE_PATTERNS - 1] == trump63[MELD_LANE_PATTERNS - 1]);
+    assert(plain61[MELD_LANE_PATTERNS - 1] == plain63[MELD_LANE_PATTERNS - 1]);
+
+    /* test the compiled-in estimate tracks what hands take in play-outs
+     * of deals the tables were not measured on: within half a point a
+     * hand on average (the bidder names the trump its estimate likes best,
+     * so it is a little high), and a quarter closer hand by hand than the
+     * mean of every hand */
+    const gchar* n71[] = { "north", "south" };
+    struct pinochle* p71 = pinochle_new(2, 2, n71, 71);
+    gint64 estimate71 = 0;
+    gint64 taken71 = 0;
+    guint64 nhands71 = 0;
+    gint32 est71[2 * 4000];
+    gint32 took71[2 * 4000];
+    for (guint64 i = 0; i < 4000; i++) {
+        pinochle_reset(p71, (1ULL << 40) + i);
+        pinochle_deal_init(p71);
+        sim_bid(p71);
+        for (guint32 seat = 0; seat < 2; seat++) {
+            est71[nhands71 + seat] =
+              (gint32)bid_trick_estimate(p71->hands[seat].cards, p71->trump);
+        }
+        while (pinochle_is_over(p71) == 0) {
+            struct card_set legal = pinochle_legal_plays(p71);
+            pinochle_play_slot(p71,
+                               (guint8)bit_first(card_set_presence(legal)));
+        }
+        for (guint32 seat = 0; seat < 2; seat++) {
+            took71[nhands71] = 10 * (gint32)p71->players[seat].points;
+            estimate71 += est71[nhands71];
+            taken71 += took71[nhands71];
+            nhands71++;
+        }
+    }
+    pinochle_free(p71);
+    gint64 mean71 = taken71 / (gint64)nhands71;
+    gint64 off71 = 0;
+    gint64 flat71 = 0;
+    for (guint64 i = 0; i < nhands71; i++) {
+        off71 += labs(est71[i] - took71[i]);
+        flat71 += labs(mean71 - took71[i]);
+    }
+    assert(labs(estimate71 - taken71) < 5 * (gint64)nhands71);
+    assert(4 * off71 < 3 * flat71);
+
+    printf("[+] Finished tests for simulate.\n");
+}
+/* ***** */
+
+/* *** soak *** */
+/* creates, deals, plays and frees games over and over, reporting the
+ * heap in use and the peak resident set size as it goes. if teardown
+ * releases everything the heap in use stops growing after the first
+ * checkpoint. the resident set is no good for that: a small leak lands in
+ * heap that earlier work freed and is already resident. */
+#define SOAK_CHECKPOINTS 10
+
+/* bytes the process has malloc'd and not freed, or -1 where the c library
+ * cannot tell. */
+glong
+soak_heap_bytes()
+{
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+    return (glong)mallinfo2().uordblks;
+#else
+    return -1;
+#endif
+}
+
+/* peak resident set size of the process in kilobytes. */
+glong
+soak_peak_rss_kb()
+{
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return -1;
+    }
+
+    return usage.ru_maxrss;
+}
+
+/* one create/deal/play/free cycle, plus the standalone objects that are
+ * not part of a game. returns the points taken so the work is kept. */
+guint32
+soak_cycle(guint64 seed)
+{
+    const gchar* names[] = { "north", "east", "south", "west" };
+    struct pinochle* p = pinochle_new(NPLAYERS, NDECKS, names, seed);
+    pinochle_deal_init(p);
+    pinochle_play_begin(p, (enum suit)(seed % NSUIT));
+    while (pinochle_is_over(p) == 0) {
+        struct card_set legal = pinochle_legal_plays(p);
+        pinochle_play_slot(p, (guint8)bit_first(card_set_presence(legal)));
+    }
+    guint32 points = pinochle_player(p, 0)->points;
+    pinochle_free(p);
+
+    struct player* pl = player_new(names[seed % 4], 0);
+    struct deck* d = deck_new();
+    struct card c;
+    while (deck_count(d) > 0) {
+        deck_draw(d, 0, &c);
+        card_list_add(pl->hand, &c);
+    }
+    points += (guint32)strlen(card_str(&c));
+    deck_free(d);
+    player_free(pl);
+
+    return points;
+}
+
+/* runs ncycles cycles, writing the heap in use and the peak rss at each
+ * checkpoint to out as csv. returns the heap in use at the last
+ * checkpoint. */
+glong
+soak_run(guint64 ncycles, guint64 seed, FILE* out)
+{
+    guint64 step = ncycles / SOAK_CHECKPOINTS > 0 ? ncycles / SOAK_CHECKPOINTS
+                                                  : 1;
+    guint64 points = 0;
+    glong heap = soak_heap_bytes();
+    fprintf(out, "cycles,heap_bytes,peak_rss_kb\n");
+    fprintf(out, "0,%ld,%ld\n", heap, soak_peak_rss_kb());
+    for (guint64 i = 0; i < ncycles; i++) {
+        points += soak_cycle(seed + i);
+        if ((i + 1) % step == 0 || i + 1 == ncycles) {
+            heap = soak_heap_bytes();
+            fprintf(out,
+                    "%" G_GUINT64_FORMAT ",%ld,%ld\n",
+                    i + 1,
+                    heap,
+                    soak_peak_rss_kb());
+        }
+    }
+    fprintf(out, "points,%" G_GUINT64_FORMAT "\n", points);
+
+    return heap;
+}
+
+/* console soak <ncycles> [seed] */
+int
+soak_main(int argc, char** argv)
+{
+    if (argc < 3) {
+        printf("usage: %s soak <ncycles> [seed]\n", argv[0]);
+
+        return 1;
+    }
+    guint64 ncycles = g_ascii_strtoull(argv[2], NULL, 10);
+    guint64 seed = argc > 3 ? g_ascii_strtoull(argv[3], NULL, 10) : 1;
+
+    gint64 start = g_get_monotonic_time();
+    soak_run(ncycles, seed, stdout);
+    gint64 elapsed = g_get_monotonic_time() - start;
+    printf("seconds,%.3f\n", (double)elapsed / G_USEC_PER_SEC);
+
+    return 0;
+}
+
+void
+soak_tests()
+{
+    printf("[+] Running tests for soak.\n");
+
+    /* test a cycle plays a whole hand and is repeatable */
+    assert(soak_cycle(7) == soak_cycle(7));
+
+    /* test memory stays flat over many cycles: from a checkpoint at 20000
+     * cycles to one at 200000 the heap in use grows by less than half a
+     * byte a cycle, where the c library can tell */
+    FILE* out = tmpfile();
+    glong at20k = soak_run(20000, 1, out);
+    glong at200k = soak_run(180000, 20001, out);
+    assert(at200k - at20k < 180000 / 2);
+
+    /* test each run wrote its header, the checkpoints and the points */
+    rewind(out);
+    gchar line[64];
+    guint32 nlines = 0;
+    guint32 nheaders = 0;
+    while (fgets(line, sizeof(line), out) != NULL) {
+        nheaders += g_strcmp0(line, "cycles,heap_bytes,peak_rss_kb\n") == 0;
+        nlines++;
+    }
+    assert(nheaders == 2 && nlines == 2 * (SOAK_CHECKPOINTS + 3));
+    fclose(out);
+
+    printf("[+] Finished tests for soak.\n");
+}
+/* ***** */
+
+/* *** server *** */
+/* hosts many tables in one process. a table is a game plus an inbox of
+ * events (a new deal, bids, plays from a client). posting an event to an
+ * idle table puts the table on the ready queue, and a fixed pool of
+ * workers takes tables from it and handles their events, so each table is
+ * only ever touched by one worker at a time and needs no lock of its own
+ * beyond its inbox. seats without a client are played by the bots, which
+ * a worker runs until a client has to act or the hand is over. a table
+ * whose hand is over keeps only its result, and a closed table goes on
+ * a free list for the next new to take.
+ *
+ * clients speak a line protocol over stdin/stdout or a unix socket:
+ *
+ *   new <seed> <human|bots> [players]
+ *                             -> table <id>      (a human plays seat 0)
+ *   bid <id> <value>
+ *   pass <id>
+ *   trump <id> <clubs|diamonds|hearts|spades>
+ *   bury <id> <code>          after picking up the widow
+ *   play <id> <code>          such as "play 3 QS"
+ *   show <id>                 -> state <id> <phase> <seat to act> <tricks>
+ *                                <points by seat>
+ *   watch <id>                -> view <id> <version> <tricks>
+ *                                <points by seat> <cards played>
+ *   close <id>
+ *   stats                     -> stats <tables> <events> <hands>
+ *   quit                      ends this client
+ *   shutdown                  stops the server
+ *
+ * only the client that made a table may move at it, show it or close
+ * it; anyone may watch it. the tables of a client that goes are closed.
+ *
+ * and the server tells the client
+ *
+ *   turn <id> bid <min> <hand>   turn <id> trump <hand>
+ *   turn <id> bury <count> <hand>
+ *   turn <id> play <legal cards>
+ *   over <id> <points by seat>
+ *   err <id> <why> */
+#define SERVER_INBOX 32
+#define SERVER_LINE_MAX 256
+#define SERVER_TABLES 16384
+
+enum table_phase
+{
+    table_closed,
+    table_auction,
+    table_trump,
+    table_bury,
+    table_play,
+    table_over
+};
+
+const gchar* const TABLE_PHASE_NAMES[] = { "closed", "auction", "trump",
+                                           "bury",   "play",    "over" };
+
+enum server_event_kind
+{
+    event_start,
+    event_bid,
+    event_pass,
+    event_trump,
+    event_bury,
+    event_play,
+    event_show,
+    event_close
+};
+
+struct server_event
+{
+    guint8 kind; /* an enum server_event_kind */
+    guint32 value;
+};
+
+struct server_client
+{
+    FILE* out; /* NULL once the client has gone */
+    GMutex lock;
+    guint32 ntables; /* tables it owns, under the server lock */
+    struct server_client* next;
+};
+
+struct table
+{
+    guint32 id;
+    struct pinochle* game;
+    enum table_phase phase;
+    guint32 humans; /* one bit per seat a client plays */
+    guint32 nplayers;
+    guint64 seed;
+    struct server_client* owner; /* set under the server lock */
+    /* the result, kept once the hand is over and the game freed */
+    guint32 ntricks;
+    guint32 points[PINOCHLE_MAX_SEATS];
+    /* the lock guards the inbox and scheduled only */
+    GMutex lock;
+    struct server_event inbox[SERVER_INBOX];
+    guint32 head;
+    guint32 count;
+    guint32 scheduled; /* on the ready queue or held by a worker */
+    struct view_cell view; /* for watch, which does not wait on the table */
+};
+
+struct server
+{
+    struct table* tables;
+    guint32 max_tables;
+    guint32 ntables; /* tables ever opened */
+    guint32* free_ids; /* closed tables to reuse */
+    guint32 nfree;
+    GAsyncQueue* ready;
+    GThread** workers;
+    guint32 nworkers;
+    struct table stop; /* pushed once per worker to stop the pool */
+    /* the lock guards ntables, the free list, the owners, clients,
+     * pending and the counts */
+    GMutex lock;
+    GCond idle;
+    guint64 pending; /* events posted and not yet handled */
+    struct server_client* clients;
+    guint64 nevents;
+    guint64 nhands;
+    gint stopping;
+};
+
+/* writes one line to the client, if it is still there. */
+void
+server_send(struct server_client* c, const gchar* fmt, ...)
+{
+    g_mutex_lock(&c->lock);
+    if (c->out != NULL) {
+        va_list args;
+        va_start(args, fmt);
+        vfprintf(c->out, fmt, args);
+        va_end(args);
+        fflush(c->out);
+    }
+    g_mutex_unlock(&c->lock);
+}
+
+struct server_client*
+server_client_new(struct server* s, FILE* out)
+{
+    struct server_client* c = malloc(sizeof(struct server_client));
+    c->out = out;
+    g_mutex_init(&c->lock);
+    c->ntables = 0;
+    g_mutex_lock(&s->lock);
+    c->next = s->clients;
+    s->clients = c;
+    g_mutex_unlock(&s->lock);
+
+    return c;
+}
+
+/* the client is gone: later lines to it are dropped. closes out if asked. */
+void
+server_client_close(struct server_client* c, guint32 close_out)
+{
+    g_mutex_lock(&c->lock);
+    if (close_out && c->out != NULL) {
+        fclose(c->out);
+    }
+    c->out = NULL;
+    g_mutex_unlock(&c->lock);
+}
+
+guint32
+table_to_act(struct table* t)
+{
+    if (t->phase == table_auction) {
+        return t->game->auction.to_act;
+    } else if (t->phase == table_trump || t->phase == table_bury) {
+        return t->game->auction.high_bidder;
+    } else {
+        return pinochle_to_act(t->game);
+    }
+}
+
+/* tells the owner it is their turn. */
+void
+server_send_turn(struct table* t)
+{
+    struct pinochle* p = t->game;
+    struct card_set hand = p->hands[table_to_act(t)].cards;
+    gchar buf[CARD_SET_STR_MAX];
+    if (t->phase == table_auction) {
+        card_set_format(hand, buf);
+        server_send(t->owner,
+                    "turn %u bid %u %s",
+                    t->id,
+                    auction_min_bid(&p->auction),
+                    buf);
+    } else if (t->phase == table_trump) {
+        card_set_format(hand, buf);
+        server_send(t->owner, "turn %u trump %s", t->id, buf);
+    } else if (t->phase == table_bury) {
+        card_set_format(hand, buf);
+        server_send(t->owner,
+                    "turn %u bury %u %s",
+                    t->id,
+                    pinochle_to_bury(p),
+                    buf);
+    } else {
+        card_set_format(pinochle_legal_plays(p), buf);
+        server_send(t->owner, "turn %u play %s", t->id, buf);
+    }
+}
+
+/* the phase after the auction or trump: the high bidder picks up the
+ * widow before naming trump and buries after. */
+void
+table_phase_next(struct table* t)
+{
+    struct pinochle* p = t->game;
+    if (t->phase == table_auction && p->auction.done) {
+        pinochle_take_widow(p);
+        t->phase = table_trump;
+    } else if (t->phase == table_trump || t->phase == table_bury) {
+        t->phase = pinochle_to_bury(p) > 0 ? table_bury : table_play;
+    }
+}
+
+/* plays bot seats until a human has to act or the hand is over. */
+void
+server_advance(struct server* s, struct table* t)
+{
+    struct pinochle* p = t->game;
+    while (t->phase != table_over) {
+        guint32 seat = table_to_act(t);
+        if ((t->humans >> seat) & 1) {
+            server_send_turn(t);
+
+            return;
+        }
+        struct card_list* hand = &p->hands[seat];
+        if (t->phase == table_auction) {
+            guint32 bid = pinochle_decide_bid(p);
+            if (bid > 0) {
+                pinochle_bid(p, bid);
+            } else {
+                pinochle_pass(p);
+            }
+            table_phase_next(t);
+        } else if (t->phase == table_trump) {
+            pinochle_play_begin(
+              p, bid_estimate_extra(hand->cards, hand->extra).trump);
+            table_phase_next(t);
+        } else if (t->phase == table_bury) {
+            pinochle_bury_best(p);
+            table_phase_next(t);
+        } else {
+            struct card_set legal = pinochle_legal_plays(p);
+            pinochle_play_slot(p, (guint8)bit_first(card_set_presence(legal)));
+            if (pinochle_is_over(p)) {
+                t->phase = table_over;
+            }
+        }
+    }
+
+    GString* line = g_string_new("");
+    g_string_append_printf(line, "over %u", t->id);
+    for (guint32 seat = 0; seat < p->nplayers; seat++) {
+        g_string_append_printf(line, " %u", pinochle_player(p, seat)->points);
+    }
+    server_send(t->owner, "%s\n", line->str);
+    g_string_free(line, TRUE);
+    g_mutex_lock(&s->lock);
+    s->nhands++;
+    g_mutex_unlock(&s->lock);
+}
+
+/* handles one event for a table held by the calling worker. */
+void
+server_handle(struct server* s, struct table* t, struct server_event* e)
+{
+    struct pinochle* p = t->game;
+    if (e->kind == event_start) {
+        const gchar* names[] = { "north", "east", "south", "west" };
+        t->game = pinochle_new(t->nplayers, NDECKS, names, t->seed);
+        pinochle_deal_init(t->game);
+        pinochle_auction_begin(t->game);
+        t->phase = table_auction;
+        server_advance(s, t);
+
+        return;
+    }
+    if (t->phase == table_closed) {
+        server_send(t->owner, "err %u closed\n", t->id);
+
+        return;
+    }
+    if (e->kind == event_show) {
+        GString* line = g_string_new("");
+        g_string_append_printf(line,
+                               "state %u %s %u %u",
+                               t->id,
+                               TABLE_PHASE_NAMES[t->phase],
+                               p != NULL ? table_to_act(t) : 0,
+                               p != NULL ? p->ntricks : t->ntricks);
+        for (guint32 seat = 0; seat < t->nplayers; seat++) {
+            g_string_append_printf(
+              line,
+              " %u",
+              p != NULL ? pinochle_player(p, seat)->points : t->points[seat]);
+        }
+        server_send(t->owner, "%s\n", line->str);
+        g_string_free(line, TRUE);
+
+        return;
+    }
+    if (e->kind == event_close) {
+        view_unpublish(&t->view);
+        if (p != NULL) {
+            pinochle_free(p);
+        }
+        t->game = NULL;
+        t->phase = table_closed;
+
+        return;
+    }
+    if (t->phase == table_over || ((t->humans >> table_to_act(t)) & 1) == 0) {
+        server_send(t->owner, "err %u not your turn\n", t->id);
+
+        return;
+    }
+
+    if (e->kind == event_bid && t->phase == table_auction &&
+        e->value >= auction_min_bid(&p->auction)) {
+        pinochle_bid(p, e->value);
+    } else if (e->kind == event_pass && t->phase == table_auction) {
+        pinochle_pass(p);
+    } else if (e->kind == event_trump && t->phase == table_trump) {
+        pinochle_play_begin(p, (enum suit)e->value);
+    } else if (e->kind == event_bury && t->phase == table_bury &&
+               ((p->hands[table_to_act(t)].cards.bits >> e->value) &
+                CARD_SET_FIELD_MASK) != 0) {
+        pinochle_bury_slot(p, (guint8)e->value);
+    } else if (e->kind == event_play && t->phase == table_play &&
+               ((pinochle_legal_plays(p).bits >> e->value) &
+                CARD_SET_FIELD_MASK) != 0) {
+        pinochle_play_slot(p, (guint8)e->value);
+        if (pinochle_is_over(p)) {
+            t->phase = table_over;
+        }
+    } else {
+        server_send(t->owner, "err %u not allowed\n", t->id);
+        server_send_turn(t);
+
+        return;
+    }
+    table_phase_next(t);
+    server_advance(s, t);
+}
+
+enum server_post_result
+{
+    post_queued,
+    post_full,
+    post_not_owner
+};
+
+/* queues an event from client c for a table, which c must own. */
+enum server_post_result
+server_post(struct server* s,
+            struct table* t,
+            struct server_client* c,
+            guint32 kind,
+            guint32 value)
+{
+    g_mutex_lock(&t->lock);
+    if (t->count == SERVER_INBOX) {
+        g_mutex_unlock(&t->lock);
+
+        return post_full;
+    }
+    g_mutex_lock(&s->lock);
+    if (t->owner != c) {
+        g_mutex_unlock(&s->lock);
+        g_mutex_unlock(&t->lock);
+
+        return post_not_owner;
+    }
+    s->pending++;
+    g_mutex_unlock(&s->lock);
+    struct server_event* e = &t->inbox[(t->head + t->count) % SERVER_INBOX];
+    e->kind = (guint8)kind;
+    e->value = value;
+    t->count++;
+    guint32 schedule = t->scheduled == 0;
+    t->scheduled = 1;
+    g_mutex_unlock(&t->lock);
+    if (schedule) {
+        g_async_queue_push(s->ready, t);
+    }
+
+    return post_queued;
+}
+
+/* posts close to every table the client owns, waits for them to be
+ * released and frees the client. the caller must not post for it any
+ * more. */
+void
+server_client_leave(struct server* s,
+                    struct server_client* c,
+                    guint32 close_out)
+{
+    server_client_close(c, close_out);
+    g_mutex_lock(&s->lock);
+    guint32 ntables = s->ntables;
+    g_mutex_unlock(&s->lock);
+    for (guint32 i = 0; i < ntables; i++) {
+        /* server_post() checks the owner again under the lock */
+        struct table* t = &s->tables[i];
+        g_mutex_lock(&s->lock);
+        guint32 mine = t->owner == c;
+        g_mutex_unlock(&s->lock);
+        while (mine && server_post(s, t, c, event_close, 0) == post_full) {
+            g_thread_yield();
+        }
+    }
+
+    g_mutex_lock(&s->lock);
+    while (c->ntables > 0) {
+        g_cond_wait(&s->idle, &s->lock);
+    }
+    struct server_client** link = &s->clients;
+    while (*link != c) {
+        link = &(*link)->next;
+    }
+    *link = c->next;
+    g_mutex_unlock(&s->lock);
+    g_mutex_clear(&c->lock);
+    free(c);
+}
+
+/* keeps the result of a finished hand and frees its game. */
+void
+table_retire(struct table* t)
+{
+    struct pinochle* p = t->game;
+    t->ntricks = p->ntricks;
+    for (guint32 seat = 0; seat < p->nplayers; seat++) {
+        t->points[seat] = pinochle_player(p, seat)->points;
+    }
+    pinochle_free(p);
+    t->game = NULL;
+}
+
+gpointer
+server_worker(gpointer data)
+{
+    struct server* s = data;
+    for (;;) {
+        struct table* t = g_async_queue_pop(s->ready);
+        if (t == &s->stop) {
+            return NULL;
+        }
+        g_mutex_lock(&t->lock);
+        while (t->count > 0) {
+            struct server_event e = t->inbox[t->head];
+            t->head = (t->head + 1) % SERVER_INBOX;
+            t->count--;
+            g_mutex_unlock(&t->lock);
+
+            server_handle(s, t, &e);
+            if (t->game != NULL && e.kind != event_show) {
+                view_publish(&t->view, t->game);
+            }
+            if (t->game != NULL && t->phase == table_over) {
+                table_retire(t);
+            }
+
+            g_mutex_lock(&t->lock);
+            g_mutex_lock(&s->lock);
+            if (t->phase == table_closed && t->count == 0 &&
+                t->owner != NULL) {
+                /* nothing is queued and the owner can post no more */
+                if (--t->owner->ntables == 0) {
+                    g_cond_broadcast(&s->idle);
+                }
+                t->owner = NULL;
+                s->free_ids[s->nfree++] = t->id;
+            }
+            s->nevents++;
+            if (--s->pending == 0) {
+                g_cond_broadcast(&s->idle);
+            }
+            g_mutex_unlock(&s->lock);
+        }
+        t->scheduled = 0;
+        g_mutex_unlock(&t->lock);
+    }
+}
+
+struct server*
+server_new(guint32 max_tables, guint32 nworkers)
+{
+    struct server* s = calloc(1, sizeof(struct server));
+    s->max_tables = max_tables;
+    s->tables = calloc(max_tables, sizeof(struct table));
+    s->free_ids = malloc(max_tables * sizeof(guint32));
+    for (guint32 i = 0; i < max_tables; i++) {
+        s->tables[i].id = i;
+        g_mutex_init(&s->tables[i].lock);
+        view_cell_init(&s->tables[i].view);
+    }
+    s->ready = g_async_queue_new();
+    g_mutex_init(&s->lock);
+    g_cond_init(&s->idle);
+    s->nworkers = nworkers;
+    s->workers = malloc(nworkers * sizeof(GThread*));
+    for (guint32 i = 0; i < nworkers; i++) {
+        s->workers[i] = g_thread_new("table", server_worker, s);
+    }
+
+    return s;
+}
+
+/* waits until every posted event has been handled. */
+void
+server_wait_idle(struct server* s)
+{
+    g_mutex_lock(&s->lock);
+    while (s->pending > 0) {
+        g_cond_wait(&s->idle, &s->lock);
+    }
+    g_mutex_unlock(&s->lock);
+}
+
+/* finishes the queued work, stops the workers and frees everything. */
+void
+server_free(struct server* s)
+{
+    server_wait_idle(s);
+    for (guint32 i = 0; i < s->nworkers; i++) {
+        g_async_queue_push(s->ready, &s->stop);
+    }
+    for (guint32 i = 0; i < s->nworkers; i++) {
+        g_thread_join(s->workers[i]);
+    }
+    for (guint32 i = 0; i < s->ntables; i++) {
+        if (s->tables[i].game != NULL) {
+            pinochle_free(s->tables[i].game);
+        }
+        view_cell_clear(&s->tables[i].view);
+        g_mutex_clear(&s->tables[i].lock);
+    }
+    struct server_client* c = s->clients;
+    while (c != NULL) {
+        struct server_client* next = c->next;
+        g_mutex_clear(&c->lock);
+        free(c);
+        c = next;
+    }
+    g_async_queue_unref(s->ready);
+    g_cond_clear(&s->idle);
+    g_mutex_clear(&s->lock);
+    free(s->workers);
+    free(s->free_ids);
+    free(s->tables);
+    free(s);
+}
+
+/* the table named by id, or NULL after telling the client why not. */
+struct table*
+server_table(struct server* s, struct server_client* c, const gchar* id)
+{
+    gchar* end = NULL;
+    guint64 i = id != NULL ? g_ascii_strtoull(id, &end, 10) : 0;
+    g_mutex_lock(&s->lock);
+    guint32 ntables = s->ntables;
+    g_mutex_unlock(&s->lock);
+    if (id == NULL || end == id || i >= ntables) {
+        server_send(c, "err %s no such table\n", id != NULL ? id : "-");
+
+        return NULL;
+    }
+
+    return &s->tables[i];
+}
+
+/* answers watch from the table's published view, so a spectator never
+ * waits behind the table's moves. */
+void
+server_send_view(struct server_client* c, struct table* t)
+{
+    if (view_reader_self() == NULL) {
+        /* every reader slot is taken by other clients */
+        server_send(c, "err %u busy\n", t->id);
+
+        return;
+    }
+    GString* line = g_string_new("");
+    const struct game_view* v = view_read_begin(&t->view);
+    if (v != NULL) {
+        g_string_append_printf(line,
+                               "view %u %" G_GUINT64_FORMAT " %u",
+                               t->id,
+                               v->version,
+                               v->state.ntricks);
+        for (guint32 seat = 0; seat < v->nplayers; seat++) {
+            g_string_append_printf(line, " %u", v->state.points[seat]);
+        }
+        struct card card;
+        for (guint32 i = 0; i < v->nplays; i++) {
+            card_slot_card(v->plays[i], &card);
+            g_string_append_printf(line, " %s", card_code(&card));
+        }
+    }
+    view_read_end();
+    if (v != NULL) {
+        server_send(c, "%s\n", line->str);
+    } else {
+        server_send(c, "err %u nothing to watch\n", t->id);
+    }
+    g_string_free(line, TRUE);
+}
+
+/* handles one protocol line from c. returns 0 when the client is done. */
+unsigned int
+server_command(struct server* s, struct server_client* c, const gchar* line)
+{
+    gchar** w = g_strsplit(line, " ", 4);
+    guint32 nwords = 0;
+    while (w[nwords] != NULL) {
+        g_strstrip(w[nwords]);
+        nwords++;
+    }
+    unsigned int more = 1;
+    const gchar* cmd = nwords > 0 ? w[0] : "";
+    struct table* t = NULL;
+    enum server_post_result posted = post_queued;
+
+    guint32 nplayers = nwords > 3 ? (guint32)atoi(w[3]) : NPLAYERS;
+    if (g_strcmp0(cmd, "new") == 0 &&
+        pinochle_variant_find(nplayers, NDECKS) == NULL) {
+        server_send(c, "err - no game for %u players\n", nplayers);
+    } else if (g_strcmp0(cmd, "new") == 0) {
+        /* set up under the lock, so no one can name the table or post to
+         * it before it is ready */
+        g_mutex_lock(&s->lock);
+        if (s->nfree > 0) {
+            t = &s->tables[s->free_ids[--s->nfree]];
+        } else if (s->ntables < s->max_tables) {
+            t = &s->tables[s->ntables++];
+        }
+        if (t != NULL) {
+            t->seed = nwords > 1 ? g_ascii_strtoull(w[1], NULL, 10) : t->id;
+            t->humans = nwords > 2 && g_strcmp0(w[2], "human") == 0 ? 1 : 0;
+            t->nplayers = nplayers;
+            t->owner = c;
+            c->ntables++;
+        }
+        g_mutex_unlock(&s->lock);
+        if (t == NULL) {
+            server_send(c, "err - too many tables\n");
+        } else {
+            server_send(c, "table %u\n", t->id);
+            posted = server_post(s, t, c, event_start, 0);
+        }
+    } else if (g_strcmp0(cmd, "bid") == 0 || g_strcmp0(cmd, "pass") == 0 ||
+               g_strcmp0(cmd, "trump") == 0 || g_strcmp0(cmd, "bury") == 0 ||
+               g_strcmp0(cmd, "play") == 0 || g_strcmp0(cmd, "show") == 0 ||
+               g_strcmp0(cmd, "close") == 0) {
+        t = server_table(s, c, nwords > 1 ? w[1] : NULL);
+        const gchar* arg = nwords > 2 ? w[2] : "";
+        struct card card;
+        if (t == NULL) {
+            /* already answered */
+        } else if (g_strcmp0(cmd, "bid") == 0) {
+            gchar* end = NULL;
+            guint64 bid = g_ascii_strtoull(arg, &end, 10);
+            if (end == arg || *end != '\0' || bid > MAX_BID) {
+                server_send(c, "err %u no such bid\n", t->id);
+            } else {
+                posted = server_post(s, t, c, event_bid, (guint32)bid);
+            }
+        } else if (g_strcmp0(cmd, "pass") == 0) {
+            posted = server_post(s, t, c, event_pass, 0);
+        } else if (g_strcmp0(cmd, "trump") == 0) {
+            guint32 suit = 0;
+            while (suit < NSUIT && g_strcmp0(arg, SUIT_NAMES[suit]) != 0) {
+                suit++;
+            }
+            if (suit == NSUIT) {
+                server_send(c, "err %u no such suit\n", t->id);
+            } else {
+                posted = server_post(s, t, c, event_trump, suit);
+            }
+        } else if (g_strcmp0(cmd, "play") == 0 ||
+                   g_strcmp0(cmd, "bury") == 0) {
+            guint32 kind = cmd[0] == 'p' ? event_play : event_bury;
+            if (card_parse_code(arg, &card) == 0) {
+                server_send(c, "err %u no such card\n", t->id);
+            } else {
+                posted = server_post(
+                  s, t, c, kind, card_set_shift(card.rank, card.suit));
+            }
+        } else if (g_strcmp0(cmd, "show") == 0) {
+            posted = server_post(s, t, c, event_show, 0);
+        } else {
+            posted = server_post(s, t, c, event_close, 0);
+        }
+    } else if (g_strcmp0(cmd, "watch") == 0) {
+        t = server_table(s, c, nwords > 1 ? w[1] : NULL);
+        if (t != NULL) {
+            server_send_view(c, t);
+        }
+    } else if (g_strcmp0(cmd, "stats") == 0) {
+        g_mutex_lock(&s->lock);
+        guint32 ntables = s->ntables - s->nfree;
+        guint64 nevents = s->nevents;
+        guint64 nhands = s->nhands;
+        g_mutex_unlock(&s->lock);
+        server_send(c,
+                    "stats %u %" G_GUINT64_FORMAT " %" G_GUINT64_FORMAT "\n",
+                    ntables,
+                    nevents,
+                    nhands);
+    } else if (g_strcmp0(cmd, "quit") == 0) {
+        more = 0;
+    } else if (g_strcmp0(cmd, "shutdown") == 0) {
+        g_atomic_int_set(&s->stopping, 1);
+        more = 0;
+    } else if (cmd[0] != '\0') {
+        server_send(c, "err - unknown command %s\n", cmd);
+    }
+    if (posted == post_full) {
+        server_send(c, "err %u busy\n", t->id);
+    } else if (posted == post_not_owner) {
+        server_send(c, "err %u not your table\n", t->id);
+    }
+    g_strfreev(w);
+
+    return more;
+}
+
+/* reads protocol lines from in until the client quits or goes. */
+void
+server_read(struct server* s, struct server_client* c, FILE* in)
+{
+    gchar line[SERVER_LINE_MAX];
+    while (fgets(line, sizeof(line), in) != NULL) {
+        if (server_command(s, c, line) == 0) {
+            break;
+        }
+    }
+}
+
+/* a socket client's thread. the listener owns the socket, so it can shut
+ * it down to wake the thread, and joins the thread before closing it. */
+struct server_conn
+{
+    struct server* server;
+    int fd;
+    GThread* thread;
+    gint done;
+    struct server_conn* next;
+};
+
+gpointer
+server_conn_run(gpointer data)
+{
+    struct server_conn* conn = data;
+    FILE* in = fdopen(dup(conn->fd), "r");
+    FILE* out = fdopen(dup(conn->fd), "w");
+    struct server_client* c = server_client_new(conn->server, out);
+    server_read(conn->server, c, in);
+    view_reader_release();
+    server_client_leave(conn->server, c, 1);
+    fclose(in);
+    g_atomic_int_set(&conn->done, 1);
+
+    return NULL;
+}
+
+void
+server_conn_free(struct server_conn* conn)
+{
+    g_thread_join(conn->thread);
+    close(conn->fd);
+    free(conn);
+}
+
+/* serves clients on a unix socket at path until one sends shutdown. the
+ * other clients are cut off and their threads joined before it returns,
+ * so the server can be freed. */
+int
+server_listen(struct server* s, const gchar* path)
+{
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    g_strlcpy(addr.sun_path, path, sizeof(addr.sun_path));
+    unlink(path);
+    if (fd < 0 || bind(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0 ||
+        listen(fd, 64) != 0) {
+        printf("ERROR: Cannot listen on %s.\n", path);
+
+        return 1;
+    }
+    struct server_conn* conns = NULL;
+    while (g_atomic_int_get(&s->stopping) == 0) {
+        /* join the clients that have gone */
+        struct server_conn** link = &conns;
+        while (*link != NULL) {
+            struct server_conn* conn = *link;
+            if (g_atomic_int_get(&conn->done)) {
+                *link = conn->next;
+                server_conn_free(conn);
+            } else {
+                link = &conn->next;
+            }
+        }
+
+        /* wake up now and then to see if a client asked to stop */
+        struct timeval tv = { 0, 200000 };
+        fd_set fds;
+        FD_ZERO(&fds);
+        FD_SET(fd, &fds);
+        if (select(fd + 1, &fds, NULL, NULL, &tv) <= 0) {
+            continue;
+        }
+        int conn_fd = accept(fd, NULL, NULL);
+        if (conn_fd < 0) {
+            continue;
+        }
+        struct server_conn* conn = malloc(sizeof(struct server_conn));
+        conn->server = s;
+        conn->fd = conn_fd;
+        conn->done = 0;
+        conn->next = conns;
+        conns = conn;
+        conn->thread = g_thread_new("client", server_conn_run, conn);
+    }
+    close(fd);
+    unlink(path);
+    while (conns != NULL) {
+        struct server_conn* next = conns->next;
+        shutdown(conns->fd, SHUT_RD);
+        server_conn_free(conns);
+        conns = next;
+    }
+
+    return 0;
+}
+
+/* console serve [nworkers] [socket path] */
+int
+server_main(int argc, char** argv)
+{
+    guint32 nworkers = argc > 2 ? (guint32)g_ascii_strtoull(argv[2], NULL, 10)
+                                : g_get_num_processors();
+    struct server* s = server_new(SERVER_TABLES, nworkers > 0 ? nworkers : 1);
+    int status = 0;
+    if (argc > 3) {
+        status = server_listen(s, argv[3]);
+    } else {
+        struct server_client* c = server_client_new(s, stdout);
+        server_read(s, c, stdin);
+        server_wait_idle(s);
+        server_client_close(c, 0);
+    }
+    server_free(s);
+
+    return status;
+}
+
+struct server_test_listener
+{
+    struct server* server;
+    const gchar* path;
+    int status;
+};
+
+gpointer
+server_test_listen(gpointer data)
+{
+    struct server_test_listener* l = data;
+    l->status = server_listen(l->server, l->path);
+
+    return NULL;
+}
+
+/* a client socket connected to path, once something listens there. */
+int
+server_test_connect(const gchar* path)
+{
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    g_strlcpy(addr.sun_path, path, sizeof(addr.sun_path));
+    for (;;) {
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (connect(fd, (struct sockaddr*)&addr, sizeof(addr)) == 0) {
+            return fd;
+        }
+        close(fd);
+        g_usleep(10000);
+    }
+}
+
+void
+server_tests()
+{
+    printf("[+] Running tests for server.\n");
+
+    struct server* s = server_new(4096, 4);
+    FILE* out = tmpfile();
+    struct server_client* c = server_client_new(s, out);
+
+    /* test many bot tables play out across the workers */
+    gchar line[SERVER_LINE_MAX];
+    for (guint32 i = 0; i < 2000; i++) {
+        g_snprintf(line, sizeof(line), "new %u bots %u\n", i, 2 + i % 3);
+        assert(server_command(s, c, line) == 1);
+    }
+    server_wait_idle(s);
+    for (guint32 i = 0; i < 2000; i++) {
+        const struct pinochle_variant* v01 =
+          pinochle_variant_find(2 + i % 3, NDECKS);
+        assert(s->tables[i].phase == table_over);
+        assert(s->tables[i].game == NULL);
+        assert(s->tables[i].ntricks == v01->cards_per_player);
+    }
+    assert(s->nhands == 2000);
+
+    /* test a three-handed human table that outbids the bots, takes the
+     * widow and buries, and otherwise answers as the bots would */
+    server_command(s, c, "new 7 human 3\n");
+    struct table* t = &s->tables[2000];
+    server_wait_idle(s);
+    while (t->phase != table_over) {
+        struct pinochle* p = t->game;
+        struct card_set hand = p->hands[0].cards;
+        struct card c21;
+        assert(table_to_act(t) == 0);
+        if (t->phase == table_auction) {
+            g_snprintf(line,
+                       sizeof(line),
+                       "bid 2000 %u\n",
+                       auction_min_bid(&p->auction));
+        } else if (t->phase == table_trump) {
+            assert(card_set_count(hand) == 18);
+            g_snprintf(line,
+                       sizeof(line),
+                       "trump 2000 %s\n",
+                       SUIT_NAMES[bid_estimate(hand).trump]);
+        } else if (t->phase == table_bury) {
+            struct card_set bury = bid_bury(hand, p->trump, 1);
+            card_slot_card((guint8)bit_first(card_set_presence(bury)), &c21);
+            g_snprintf(line, sizeof(line), "bury 2000 %s\n", card_code(&c21));
+        } else {
+            card_slot_card(
+              (guint8)bit_first(card_set_presence(pinochle_legal_plays(p))),
+              &c21);
+            g_snprintf(line, sizeof(line), "play 2000 %s\n", card_code(&c21));
+        }
+        server_command(s, c, line);
+        server_wait_idle(s);
+    }
+    assert(t->game == NULL);
+    guint32 points21 = 0;
+    for (guint32 seat = 0; seat < 3; seat++) {
+        points21 += t->points[seat];
+    }
+    assert(points21 ==
+           card_set_count_counters(card_set_full(NDECKS)) + LAST_TRICK_POINTS);
+
+    /* test bad moves are refused and do not change the result */
+    guint32 points31[PINOCHLE_MAX_SEATS];
+    memcpy(points31, t->points, sizeof(points31));
+    server_command(s, c, "play 2000 AS\n");
+    server_command(s, c, "play 99999 AS\n");
+    server_command(s, c, "bid 2000\n");
+    server_command(s, c, "bid 2000 12x\n");
+    server_command(s, c, "bid 2000 65546\n");
+    server_command(s, c, "trump 2000 stars\n");
+    server_command(s, c, "dance\n");
+    server_command(s, c, "new 1 bots 7\n");
+    server_command(s, c, "show 2000\n");
+    server_command(s, c, "watch 2000\n");
+    /* only the owner moves at a table, though anyone may watch */
+    struct server_client* c31 = server_client_new(s, out);
+    server_command(s, c31, "close 2000\n");
+    server_command(s, c31, "watch 2000\n");
+    server_wait_idle(s);
+    assert(t->phase == table_over);
+    assert(memcmp(t->points, points31, sizeof(points31)) == 0);
+    server_command(s, c, "close 2000\n");
+    server_wait_idle(s);
+    assert(t->phase == table_closed && t->game == NULL);
+    server_command(s, c, "watch 2000\n");
+
+    /* test closed tables are reused, so max_tables only caps open ones */
+    assert(s->nfree == 1);
+    for (guint32 i = 0; i < 2000; i++) {
+        g_snprintf(line, sizeof(line), "close %u\n", i);
+        server_command(s, c, line);
+    }
+    server_wait_idle(s);
+    assert(s->nfree == 2001);
+    for (guint32 i = 0; i < 4096; i++) {
+        assert(server_command(s, c, "new 9 bots\n") == 1);
+    }
+    server_wait_idle(s);
+    assert(s->ntables == 4096 && s->nfree == 0);
+    assert(s->nhands == 2001 + 4096);
+
+    /* test a client that goes in the middle of a hand gives its tables
+     * back */
+    server_command(s, c, "close 0\n");
+    server_command(s, c, "close 1\n");
+    server_wait_idle(s);
+    assert(s->nfree == 2);
+    struct server_client* c41 = server_client_new(s, tmpfile());
+    server_command(s, c41, "new 41 human 2\n");
+    server_command(s, c41, "new 42 human 4\n");
+    server_wait_idle(s);
+    assert(s->nfree == 0 && c41->ntables == 2);
+    assert(s->tables[0].game != NULL && s->tables[1].game != NULL);
+    guint32 nclients41 = 0;
+    for (struct server_client* i = s->clients; i != NULL; i = i->next) {
+        nclients41++;
+    }
+    server_client_leave(s, c41, 1);
+    assert(s->nfree == 2);
+    assert(s->tables[0].game == NULL && s->tables[1].owner == NULL);
+    for (struct server_client* i = s->clients; i != NULL; i = i->next) {
+        nclients41--;
+    }
+    assert(nclients41 == 1);
+    assert(server_command(s, c, "quit\n") == 0);
+
+    /* the client saw a table, a result and an error for each */
+    rewind(out);
+    guint32 ntables = 0;
+    guint32 nover = 0;
+    guint32 nerr = 0;
+    guint32 nstate = 0;
+    guint32 nview = 0;
+    guint32 nbury = 0;
+    while (fgets(line, sizeof(line), out) != NULL) {
+        nbury += g_str_has_prefix(line, "turn 2000 bury ");
+        ntables += g_str_has_prefix(line, "table ");
+        nover += g_str_has_prefix(line, "over ");
+        nerr += g_str_has_prefix(line, "err ");
+        nstate += g_str_has_prefix(line, "state 2000 over ");
+        nview += g_str_has_prefix(line, "view 2000 ");
+    }
+    assert(ntables == 2001 + 4096 && nover == 2001 + 4096);
+    assert(nerr == 10 && nstate == 1 && nbury == 3);
+    assert(nview == 2);
+
+    server_client_close(c31, 0);
+    server_client_close(c, 1);
+    server_free(s);
+
+    /* test shutdown cuts off the other socket clients and joins their
+     * threads, so the server can be freed at once */
+    struct server* s51 = server_new(16, 2);
+    gchar* path51 =
+      g_strdup_printf("%s/pinochle-test-%d.sock", g_get_tmp_dir(), getpid());
+    struct server_test_listener l51 = { s51, path51, -1 };
+    GThread* listener51 = g_thread_new("listen", server_test_listen, &l51);
+    int fd51 = server_test_connect(path51);
+    assert(write(fd51, "new 51 human\n", 13) == 13);
+    FILE* in51 = fdopen(fd51, "r");
+    assert(fgets(line, sizeof(line), in51) != NULL);
+    assert(g_strcmp0(line, "table 0\n") == 0);
+    int fd52 = server_test_connect(path51);
+    assert(write(fd52, "shutdown\n", 9) == 9);
+    g_thread_join(listener51);
+    assert(l51.status == 0);
+    assert(s51->clients == NULL && s51->nfree == 1);
+    server_free(s51);
+    fclose(in51);
+    close(fd52);
+    g_free(path51);
+
+    printf("[+] Finished tests for server.\n");
+}
+/* ***** */
+
+/* bench.c includes this file for the code under test and brings its own
+ * main. */
+#ifndef PINOCHLE_NO_MAIN
+int
+main(int argc, char** argv)
+{
+    stats_init();
+    if (argc > 1 && g_strcmp0(argv[1], "simulate") == 0) {
+        return sim_main(argc, argv);
+    }
+    if (argc > 1 && g_strcmp0(argv[1], "solve") == 0) {
+        return dd_main(argc, argv);
+    }
+    if (argc > 1 && g_strcmp0(argv[1], "record") == 0) {
+        return record_main(argc, argv);
+    }
+    if (argc > 1 && g_strcmp0(argv[1], "scan") == 0) {
+        return record_scan_main(argc, argv);
+    }
+    if (argc > 1 && g_strcmp0(argv[1], "replay") == 0) {
+        return replay_main(argc, argv);
+    }
+    if (argc > 1 && g_strcmp0(argv[1], "soak") == 0) {
+        return soak_main(argc, argv);
+    }
+    if (argc > 1 && g_strcmp0(argv[1], "duel") == 0) {
+        return bot_main(argc, argv);
+    }
+    if (argc > 1 && g_strcmp0(argv[1], "serve") == 0) {
+        return server_main(argc, argv);
+    }
+    if (argc > 1 && g_strcmp0(argv[1], "meld-table") == 0) {
+        return meld_write_tables(argc > 2 ? argv[2] : "meld_table.h") ? 0 : 1;
+    }
+    if (argc > 1 && g_strcmp0(argv[1], "bid-table") == 0) {
+        return bid_write_tables(argc > 2 ? argv[2] : "bid_table.h") ? 0 : 1;
+    }
+
     printf("Received %d arguments. They are.\n", argc);
     for (int i = 0; i < argc; i++) {
         printf("%s\n", argv[i]);
     }
 
+    stats_tests();
+    rng_tests();
+    arena_tests();
     card_tests();
+    card_set_tests();
     card_list_tests();
     deck_tests();
     pinochle_deck_tests();
+    meld_tests();
+    bid_tests();
+    hand_canon_tests();
+    batch_tests();
+    trick_tests();
     player_tests();
     pinochle_tests();
+    replay_tests();
+    view_tests();
+    record_tests();
+    memo_tests();
+    dd_tests();
+    bot_tests();
+    sim_tests();
+    soak_tests();
+    server_tests();
 
     printf("Goodbye.\n");
     return 0;
 }
+#endif
@@ -1,6 +1,41 @@
 add_requires("glib >=2.71.0")
 
+-- hot-path counters and timers; off unless `xmake f --stats=y`.
+option("stats")
+	set_default(false)
+	set_showmenu(true)
+	set_description("Build in the hot-path counters and timers.")
+	add_defines("PINOCHLE_STATS=1")
+
 target("console")
 	set_kind("binary")
-	add_files("*.c")
+	add_files("pinochle.c")
 	add_packages("glib")
+	add_options("stats")
+
+-- micro-benchmarks; bench.c includes pinochle.c. `xmake build bench` and
+-- `xmake run bench [--json] [--samples N] [filter]`.
+target("bench")
+	set_kind("binary")
+	set_default(false)
+	add_files("bench.c")
+	add_packages("glib")
+	add_options("stats")
+	set_optimize("fastest")
+	add_syslinks("m")
+
+-- meld_table.h is generated from the rules in pinochle.c and bid_table.h
+-- from play-outs; both are checked in. run `xmake tables` after changing
+-- the rules or the play.
+task("tables")
+	set_category("plugin")
+	on_run(function ()
+		os.exec("xmake build console")
+		os.exec("xmake run console meld-table $(projectdir)/meld_table.h")
+		os.exec("xmake run console bid-table $(projectdir)/bid_table.h")
+		os.exec("xmake build console")
+	end)
+	set_menu {
+		usage = "xmake tables",
+		description = "Regenerate meld_table.h and bid_table.h."
+	}